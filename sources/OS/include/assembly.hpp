@@ -68,7 +68,8 @@ class Program
     /// Creates a program
     /// @param _name   program's name (filename)
     /// @param _length number (lines) of assembly instructions
-    Program(std::string _name, const int _length);
+    /// @param _uuid   unique identifier, created by the game's allocator
+    Program(std::string _name, const int _length, OS::UUID _uuid);
 
     /// Adds an instruction to the programs collection
     /// @param _inst instruction object to add
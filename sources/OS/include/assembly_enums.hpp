@@ -21,7 +21,7 @@ enum class Opcode : int
     ADD, // Add:      B -> A + B
     SUB, // Subtract: B -> B - A
     MUL, // Multiply: B -> A * B
-    DIV, // Divide:   B -> B / A (division by zero is illegal, thus kills the process)
+    DIV, // Divide:   B -> B / A (division by zero is illegal, thus kills the process: a zero in any pair of fields)
     MOD, // Modulus:  B -> B % A 
 
     /* Jump */
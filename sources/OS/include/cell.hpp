@@ -0,0 +1,140 @@
+/// Packed assembly instruction stored at each address of the core
+#pragma once
+
+#include <stdint.h>
+#include "assembly.hpp"
+
+namespace Asm
+{
+/// Packs an assembly instruction into a single 64-bit word (8 bytes per address),
+/// Inst remains the decoded view used by the parser and the GUI
+///
+///     [ 0.. 3] opcode   (xor DAT)  | [ 4.. 6] modifier (xor F)
+///     [ 7.. 9] A admo              | [10..12] B admo
+///     [13..15] unused              | [16..39] A value | [40..63] B value
+///
+/// Opcode and modifier are stored relative to 'DAT.F' so a zeroed word is 'DAT.F #0, #0',
+/// operand values are unsigned, the memory keeps them normalised to [0, core size).
+/// The operation bits [0..6] only change on 'MOV.I' or a load, so they key the pre-decoded operation
+
+struct Cell
+{
+ private:
+    static int constexpr code_shift = 0,  mod_shift = 4,
+                         admo_a_shift = 7, admo_b_shift = 10,
+                         val_a_shift = 16, val_b_shift  = 40;
+    static int      constexpr val_bits = 24;                    // bits of an operand value
+    static uint64_t constexpr code_mask = 0xF,
+                              mod_mask  = 0x7,
+                              admo_mask = 0x7,
+                              val_mask  = (1ull << val_bits) - 1;
+
+    static uint64_t constexpr default_code = (uint64_t) Opcode::DAT,
+                              default_mod  = (uint64_t) Modifier::F;
+
+    /// Returns the shift of the operand value
+    static inline int constexpr val_shift(InstField _field)
+    {
+        return (_field == InstField::A) ? val_a_shift : val_b_shift;
+    }
+
+ public:
+    static int constexpr op_count  = 1 << 7;        // number of operation keys (opcode + modifier bits)
+    static int constexpr admo_count = 1 << 6;       // number of addressing keys (A + B admo bits)
+    static int constexpr val_range = 1 << val_bits; // operand values are stored in [0, val_range)
+
+    uint64_t word = 0;  // packed instruction, [default] 'DAT.F #0, #0'
+
+    Cell() = default;
+
+    /// Packs an instruction, operand values are truncated to 24-bits (normalise before packing)
+    /// @param _inst decoded instruction
+    Cell(Inst const &_inst)
+    {
+        set_code(_inst.OP.code);
+        set_mod(_inst.OP.mod);
+        set_admo(InstField::A, _inst.A.admo);
+        set_admo(InstField::B, _inst.B.admo);
+        set_val(InstField::A, _inst.A.val);
+        set_val(InstField::B, _inst.B.val);
+    }
+
+    /// Returns the decoded instruction
+    inline Inst inst() const
+    {
+        return Inst( {code(), mod()},
+                     {admo(InstField::A), val(InstField::A)},
+                     {admo(InstField::B), val(InstField::B)} );
+    }
+
+ /* Operation */
+
+    /// Returns the operation key (opcode + modifier bits), used to look up the pre-decoded operation
+    inline int op() const { return (int) (word & (op_count - 1)); }
+
+    /// Returns the opcode of an operation key
+    static inline constexpr Opcode   op_code(int _op) { return (Opcode)   (((uint64_t) _op & code_mask) ^ default_code); }
+    /// Returns the modifier of an operation key
+    static inline constexpr Modifier op_mod(int _op)  { return (Modifier) ((((uint64_t) _op >> mod_shift) & mod_mask) ^ default_mod); }
+    /// Returns the operation key of an opcode and modifier
+    static inline constexpr int to_op(Opcode _code, Modifier _mod)
+    {
+        return (int) ((((uint64_t) _code ^ default_code) & code_mask) << code_shift
+                    | (((uint64_t) _mod  ^ default_mod)  & mod_mask)  << mod_shift);
+    }
+
+    inline Opcode   code() const { return (Opcode)   (((word >> code_shift) & code_mask) ^ default_code); }
+    inline Modifier mod()  const { return (Modifier) (((word >> mod_shift)  & mod_mask)  ^ default_mod);  }
+
+    inline void set_code(Opcode _code)
+    {
+        word = (word & ~(code_mask << code_shift)) | ((((uint64_t) _code ^ default_code) & code_mask) << code_shift);
+    }
+    inline void set_mod(Modifier _mod)
+    {
+        word = (word & ~(mod_mask << mod_shift)) | ((((uint64_t) _mod ^ default_mod) & mod_mask) << mod_shift);
+    }
+
+ /* Operands */
+
+    /// Returns the addressing key (A admo + B admo * 8), used to look up the pre-decoded operand decoders
+    inline int admo_key() const { return (int) ((word >> admo_a_shift) & (admo_count - 1)); }
+
+    /// Returns the addressing mode of the A operand of an addressing key
+    static inline constexpr Admo key_admo_a(int _key) { return (Admo) (_key & admo_mask); }
+    /// Returns the addressing mode of the B operand of an addressing key
+    static inline constexpr Admo key_admo_b(int _key) { return (Admo) ((_key >> 3) & admo_mask); }
+    /// Returns the addressing key of the A and B addressing modes
+    static inline constexpr int to_admo_key(Admo _a, Admo _b) { return (int) _a | ((int) _b << 3); }
+
+    /// Returns the addressing mode of the operand
+    inline Admo admo(InstField _field) const
+    {
+        int const shift_ = (_field == InstField::A) ? admo_a_shift : admo_b_shift;
+        return (Admo) ((word >> shift_) & admo_mask);
+    }
+
+    /// Returns the value of the operand
+    inline int val(InstField _field) const
+    {
+        return (int) ((word >> val_shift(_field)) & val_mask);
+    }
+
+    inline void set_admo(InstField _field, Admo _admo)
+    {
+        int const shift_ = (_field == InstField::A) ? admo_a_shift : admo_b_shift;
+        word = (word & ~(admo_mask << shift_)) | (((uint64_t) _admo & admo_mask) << shift_);
+    }
+    inline void set_val(InstField _field, int _val)
+    {
+        int const shift_ = val_shift(_field);
+        word = (word & ~(val_mask << shift_)) | (((uint64_t) (uint32_t) _val & val_mask) << shift_);
+    }
+
+    /// Compares the whole instruction (opcode, modifier, addressing modes and values)
+    inline bool operator==(Cell const &_rhs) const { return word == _rhs.word; }
+    inline bool operator!=(Cell const &_rhs) const { return word != _rhs.word; }
+};
+static_assert(sizeof(Cell) == 8, "Asm::Cell must pack into 64-bits");
+
+} /* ::Asm */
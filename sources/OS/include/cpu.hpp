@@ -4,35 +4,181 @@
 // #define CPU_DEBUG
 // #define CPU_DEBUG_CODES
 
+#include <array>
+#include <utility>
 #include "assembly.hpp"
 #include "memory.hpp"
 #include "scheduler.hpp"
 #include "report.hpp"
+#include "observer.hpp"
+#include "profiler.hpp"
 
 /// Operating System handles: fetch/decode/execute cycle, memory simulator, and program processes
 namespace OS 
 {
 /// Handles the fetch/decode/execute cycle, memory array of assembly instructions, and program processes
-class CPU
+/// @tparam Observer policy selecting what is tracked each cycle (NullObserver, ReportObserver)
+template<typename Observer>
+class BasicCPU
 {
  private:
     Memory    *os_memory;       // memory array simulator
     Scheduler *os_sched;        // process scheduler (sched) for programs
 
+    /* Cycle State (reused every cycle, decoded in place) */
     ControlUnit ctrl;           // Control Unit from Memory, used in executiom
     PCB         exe_process;    // process executing the instruction
+    Report      m_report;       // report of the last cycle
+
+    /* Stats */
+    std::array<long long, Fused::count> m_fused_hits = {};  // [handler]: cycles run by the fused handler (see Idiom)
+
+    #ifdef CPU_PROFILE
+    Profiler *m_profiler    = nullptr;  // records every cycle of run_fde_cycle() (nullptr: none)
+    long long m_phase_start = 0;        // start of the sampled cycle's current phase (ns)
+    bool      m_sampled     = false;    // the latencies of the cycle are sampled
+    #endif
 
  public:
     /// Creates a core to fetch/decode/execute and manage a memory array simulator
-    CPU(Memory *_memory, Scheduler *_sched);
-    CPU();
+    BasicCPU(Memory *_memory, Scheduler *_sched);
+    BasicCPU();
 
  /* Execute */
 
     /// run the next fetch/decode/execute cycle, then returns an operating system report
-    Report const run_fde_cycle();
+    /// (executes the specialised kernel of the operation, a single table lookup).
+    /// An instruction of a recognised idiom (imp, stone, paper) is decoded and executed by a single fused handler
+    /// Allocation free: all cycle state is decoded in place, the report is valid until the next cycle.
+    /// Events and register logs are only reported if the observer tracks them
+    Report const &run_fde_cycle();
+    /// run the next fetch/decode/execute cycle through the switch based execute functions,
+    /// reference path for differential testing of the kernels (same results as run_fde_cycle(), full report)
+    Report const &run_reference_cycle();
+
+    /// Returns the report of the last cycle
+    inline Report const &report() const { return m_report; }
+
+    /// Attaches the profiler which records every cycle of run_fde_cycle(),
+    /// nothing is recorded (or compiled) unless built with CPU_PROFILE (see Profiler)
+    /// @param _profiler profiler sized for the programs (nullptr: detach)
+    inline void profile(Profiler *_profiler)
+    {
+        #ifdef CPU_PROFILE
+        m_profiler = _profiler;
+        #else
+        (void) _profiler;
+        #endif
+    }
+
+    /// Returns the cycles run by the fused handlers of the idiom since the cpu was created
+    inline long long idiom_hits(Idiom _idiom) const
+    {
+        long long hits_ = 0;
+        for (int i = 1; i < Fused::count; i++)
+        {
+            if (Fused::insts[i].idiom == _idiom)
+                hits_ += m_fused_hits[i];
+        }
+        return hits_;
+    }
+
+ /* Prefetch */
+
+    /// Hints the cache to load the instruction of the next cycle (two cycles ahead of prefetch_decode())
+    inline void prefetch_fetch() const { os_memory->prefetch(os_sched->next_pc()); }
+
+    /// Hints the cache to load the operands of the next cycle's instruction, after prefetch_fetch() has loaded it
+    inline void prefetch_decode() const { os_memory->prefetch_operands(os_sched->next_pc()); }
 
  private:
+ /* Kernels */
+
+    using Kernel = bool (*)(BasicCPU &_cpu);    // specialised execute phase of a single operation
+
+    /// Executes a single (Opcode, Modifier): operand fields and modifier type are resolved at compile time
+    /// @tparam Code opcode
+    /// @tparam Mod  modifier
+    /// @return true: the executing process is killed (DAT, division by zero)
+    template<Opcode Code, Modifier Mod>
+    static bool execute_kernel(BasicCPU &_cpu);
+
+    /// Sets the event of the register, compiled away if the observer does not track events
+    static inline void observe(Register &_reg, Event _event)
+    {
+        if constexpr (Observer::events)
+            _reg.event = _event;
+    }
+
+    /// Returns a kernel for every operation key, indexed by Cell::op()
+    template<std::size_t... Op>
+    static constexpr std::array<Kernel, Cell::op_count> build_kernels(std::index_sequence<Op...>);
+
+    static const std::array<Kernel, Cell::op_count> kernel_table; // kernels, indexed by Cell::op()
+
+ /* Fused Handlers */
+
+    using FusedHandler = bool (*)(BasicCPU &_cpu, int _pc, int _index, Memory::Compiled const &_cmp);
+
+    /// Decodes and executes an instruction of an idiom in a single call (superinstruction): the decoder of its
+    /// addressing modes and the kernel of its operation are inlined together (same results as run_fde_cycle())
+    /// @tparam Inst fused instruction (see Fused::insts)
+    /// @return true: the executing process is killed
+    template<std::size_t Inst>
+    static bool execute_fused(BasicCPU &_cpu, int _pc, int _index, Memory::Compiled const &_cmp);
+
+    /// Returns a fused handler for every fused instruction, indexed by Memory::Compiled::fused
+    template<std::size_t... Inst>
+    static constexpr std::array<FusedHandler, Fused::count> build_fused(std::index_sequence<Inst...>);
+
+    static const std::array<FusedHandler, Fused::count> fused_table; // fused handlers, indexed by Compiled::fused
+
+ /* Profile (compiled away unless CPU_PROFILE is defined) */
+
+    /// Records the instruction of the fetched process, starts the decode sample of a sampled cycle
+    /// @param _index normalised address of the instruction
+    inline void profile_fetch(int _index)
+    {
+        #ifdef CPU_PROFILE
+        m_sampled = m_profiler != nullptr && exe_process.status() < Status::HAULTED &&
+                    m_profiler->record(exe_process.parent(), os_memory->cell(_index));
+        if (m_sampled)
+            m_phase_start = Profiler::now();
+        #endif
+    }
+    /// Ends the decode sample, starts the execute sample
+    inline void profile_decoded()
+    {
+        #ifdef CPU_PROFILE
+        if (m_sampled)
+        {
+            long long const now_ = Profiler::now();
+            m_profiler->record_decode(now_ - m_phase_start);
+            m_phase_start = now_;
+        }
+        #endif
+    }
+    /// Ends the execute sample
+    inline void profile_executed()
+    {
+        #ifdef CPU_PROFILE
+        if (m_sampled)
+            m_profiler->record_execute(Profiler::now() - m_phase_start);
+        #endif
+    }
+    /// Returns true if the latencies of the cycle are sampled: the cycle bypasses its fused handler,
+    /// so decode and execute are timed apart (same results)
+    inline bool profile_sampled() const
+    {
+        #ifdef CPU_PROFILE
+        return m_sampled;
+        #else
+        return false;
+        #endif
+    }
+
+ /* Reference */
+
     /// Executes a (NOP, DAT, MOV)
     void execute_system();
     /// Executes a (CMP, SLT, SPL)
@@ -42,22 +188,29 @@ class CPU
     /// Executes a (JMP, JMZ, JMN, DJN)
     void execute_jump();
 
-    /// Applies an arithmetic operation to the left value
+    /// Returns the result of an arithmetic operation applied to the left value (normalised, modular arithmetic)
     /// @param operator_char char represnetation of the arithmetic operator
-    /// @param l_val modifiable left value used as the base
+    /// @param l_val left value used as the base
     /// @param r_val right value to apply to l_val
-    inline void apply_arithmatic(int &l_val, int r_val, char _operator)
+    inline int apply_arithmatic(int l_val, int r_val, char _operator)
     {
         switch (_operator)
         {
             case '+': l_val = l_val + r_val; break;
             case '-': l_val = l_val - r_val; break;
-            case '*': l_val = l_val * r_val; break;
+            case '*': l_val = (int) (((long long) l_val * r_val) % os_memory->size()); break;
             case '/': l_val = l_val / r_val; break;
             case '%': l_val = l_val % r_val; break;
             default: break;
         }
+        return os_memory->normalise(l_val);
     }
-}; /* CPU */
+}; /* BasicCPU */
+
+using CPU         = BasicCPU<ReportObserver>;   // full reports (GUI)
+using HeadlessCPU = BasicCPU<NullObserver>;     // no event tracking (batch runs)
+
+extern template class BasicCPU<NullObserver>;
+extern template class BasicCPU<ReportObserver>;
 
 } /* ::OS */
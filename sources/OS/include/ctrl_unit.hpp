@@ -2,30 +2,73 @@
 #pragma once
 
 #include "assembly.hpp"
+#include "cell.hpp"
 #include "system_enums.hpp"
 
 namespace OS
 {
 namespace /* {anonymous} */ { using namespace Asm; }
 
+/// Reference to a single operand value within a cell
+struct OperandRef
+{
+    Cell     *cell = nullptr;   // cell containing the value (or nullptr)
+    InstField field;            // selects operand A or B
+
+    inline int  get() const       { return cell->val(field);  }
+    inline void set(int _val)     { cell->set_val(field, _val); }
+};
+
 /// Register: Instruction register for the control unit decoding
-struct Register 
+struct Register
 {
     int address;                // absolute memory address
-    Inst::Operation *OP;        // operation pointer
-    Inst::Operand *A, *B;       // operand pointer
+    Cell *cell;                 // instruction at the address
+    InstField A, B;             // operand fields read as A and B (swapped by modifiers)
     Event event;                // event applied to the address
 
-    Register(int _index, Inst *_inst);
+    Register(int _index, Cell *_cell);
     Register();
 
+    /// Overwrites the register in place (same as a new Register, stored field by field without a temporary)
+    /// @param _index absolute memory address
+    /// @param _cell instruction at the address
+    inline void load(int _index, Cell *_cell)
+    {
+        address = _index;
+        cell    = _cell;
+        A       = InstField::A;
+        B       = InstField::B;
+        event   = Event::NOOP;
+    }
+
     /// Swaps the operands of the register
     inline void swap_operands()
     {
-        Inst::Operand *swap_ = A;
+        InstField swap_ = A;
         A = B;                      // A -> B
         B = swap_;                  // B -> A
     }
+
+ /* Operation */
+
+    inline Opcode   code() const { return cell->code(); }
+    inline Modifier mod()  const { return cell->mod();  }
+
+ /* Operands */
+
+    /// Returns the value of operand A (after modifier swaps)
+    inline int a() const { return cell->val(A); }
+    /// Returns the value of operand B (after modifier swaps)
+    inline int b() const { return cell->val(B); }
+
+    inline void set_a(int _val) { cell->set_val(A, _val); }
+    inline void set_b(int _val) { cell->set_val(B, _val); }
+
+    /// Returns the addressing mode of operand A (after modifier swaps)
+    inline Admo admo_a() const { return cell->admo(A); }
+    /// Returns the addressing mode of operand B (after modifier swaps)
+    inline Admo admo_b() const { return cell->admo(B); }
 };
 
 /// ControlUnit: stores the interpretation of the instruction register for the execute phase
@@ -35,8 +78,8 @@ struct ControlUnit
     Register EXE,               // executing program counter
              SRC,               // EXE's A field
              DEST;              // EXE's B field
-    int *post_A, *post_B;       // points to value to be post-incremented (or nullptr)
-    
+    OperandRef post_A, post_B;  // value to be post-incremented (cell is nullptr if none)
+
     /// Creates an Instruction ControlUnit (pre-configured for DAT opcode)
     /// @param _EXE  executing   register
     /// @param _SRC  source      register (EXE.A)
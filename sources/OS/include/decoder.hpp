@@ -0,0 +1,123 @@
+/// Pre-decoded operations, looked up from the operation bits of a cell instead of decoded each cycle
+#pragma once
+
+#include <array>
+#include "assembly.hpp"
+#include "cell.hpp"
+
+namespace OS
+{
+namespace /* {anonymous} */ { using namespace Asm; }
+
+/// Pre-decoded operation: everything the execute phase needs from an opcode and modifier
+struct Decoded
+{
+    OpcodeType   code;      // opcode type (selects the execute function)
+    ModifierType mod;       // modifier type
+    bool swap_src,          // swap SRC  A <-> B
+         swap_dest;         // swap DEST A <-> B
+};
+
+namespace Decoder
+{
+/// Returns the decoded opcode type and modifier behaviour
+/// @param _code opcode
+/// @param _mod  modifier
+inline constexpr Decoded decode(Opcode _code, Modifier _mod)
+{
+    Decoded dec_ = { OpcodeType::SYSTEM, ModifierType::SINGLE, false, false };
+
+    /* Opcode Type */
+    if      (_code <= Opcode::SPL) dec_.code = OpcodeType::SYSTEM;         // NOP, DAT, MOV, SPL
+    else if (_code <= Opcode::SLT) dec_.code = OpcodeType::COMPARISION;    // SEQ, SNE, SLT
+    else if (_code <= Opcode::MOD) dec_.code = OpcodeType::ARITHMETIC;     // ADD, SUB, MUL, DIV, MOD
+    else                           dec_.code = OpcodeType::JUMP;           // JMP, JMZ, JMN, DJN
+
+    // allows -> ModifierType::FULL
+    bool full_type = false;
+
+    /* [code] Conditionals */
+    switch (_code)
+    {
+        case Opcode::NOP:
+        case Opcode::DAT:
+        case Opcode::JMP:
+        case Opcode::SPL:
+        {
+            /* ignore modifier */
+            return dec_;
+        }
+        case Opcode::MOV:
+        case Opcode::SEQ:
+        case Opcode::SNE:
+        {
+            full_type = true;
+            break;
+        }
+        case Opcode::JMZ: // only change DEST operands on .B
+        case Opcode::JMN:
+        case Opcode::DJN:
+        {
+            if (_mod == Modifier::B)
+            {
+                dec_.swap_dest = true;
+                _mod = Modifier::A;
+            }
+            else if (_mod == Modifier::F)
+            {
+                dec_.mod = ModifierType::DOUBLE;
+                return dec_;
+            }
+            break;
+        }
+        default: break;
+    }
+
+    /* Apply Modifiers */
+    switch (_mod)
+    {
+        /* Single [default] */
+        case Modifier::A:  break;
+        case Modifier::AB: dec_.swap_dest = true;                   break;
+        case Modifier::BA: dec_.swap_src  = true;                   break;
+        case Modifier::B:  dec_.swap_src  = dec_.swap_dest = true;  break;
+
+        /* Double */
+        case Modifier::F:  dec_.mod = ModifierType::DOUBLE;         break;
+        case Modifier::X:
+        {
+            dec_.swap_dest = true;
+            dec_.mod = ModifierType::DOUBLE;
+            break;
+        }
+        /* Full */
+        case Modifier::I:
+        {
+            dec_.mod = full_type ? ModifierType::FULL
+                                 : ModifierType::DOUBLE; // else Modifier::F
+            break;
+        }
+        default: break;
+    }
+    return dec_;
+} /* decode() */
+
+/// Returns every operation decoded, indexed by the operation bits of a cell
+inline constexpr std::array<Decoded, Cell::op_count> build_table()
+{
+    std::array<Decoded, Cell::op_count> table_ {};
+    for (int op = 0; op < Cell::op_count; op++)
+    {
+        table_[op] = decode(Cell::op_code(op), Cell::op_mod(op));
+    }
+    return table_;
+}
+
+/// Decoded operations, indexed by Cell::op()
+inline constexpr std::array<Decoded, Cell::op_count> table = build_table();
+
+/// Returns the pre-decoded operation of the cell
+inline Decoded const &lookup(Cell const &_cell) { return table[_cell.op()]; }
+
+} /* ::Decoder */
+} /* ::OS */
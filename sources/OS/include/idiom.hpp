@@ -0,0 +1,77 @@
+/// Common Redcode idioms, recognised in the core and executed by fused handlers (superinstructions)
+#pragma once
+
+#include <stdint.h>
+#include "cell.hpp"
+
+namespace OS
+{
+namespace /* {anonymous} */ { using namespace Asm; }
+
+/// Redcode idioms recognised by the block cache (see Memory::compile_block())
+enum class Idiom : uint8_t
+{
+    NONE,
+    IMP,    // mov.i $0, $1
+    STONE,  // add.ab #step, $ptr | mov.i $bomb, @ptr | jmp $add          (bomber loop)
+    PAPER,  // mov.i $src (or }src), >dst | djn.b $mov, #count (or $count) (copy loop driven by djn)
+};
+static int constexpr idiom_count = 4;
+
+/// Returns the name of the idiom
+inline char const *idiom_name(Idiom _idiom)
+{
+    switch (_idiom)
+    {
+        case Idiom::IMP:   return "imp";
+        case Idiom::STONE: return "stone";
+        case Idiom::PAPER: return "paper";
+        default:           return "none";
+    }
+}
+
+/// Instruction of an idiom executed by a fused handler: decode and execute in a single call,
+/// specialised on its operation and addressing modes
+struct FusedInst
+{
+    int   op;       // operation key (see Cell::op())
+    int   key;      // addressing key (see Cell::admo_key())
+    Idiom idiom;    // idiom the instruction belongs to
+};
+
+namespace Fused
+{
+/// Instructions with a fused handler, indexed by the handler (0: none, the cell is decoded then executed)
+static constexpr FusedInst insts[] =
+{
+    { 0, 0, Idiom::NONE },
+    /* Imp */
+    { Cell::to_op(Opcode::MOV, Modifier::I),  Cell::to_admo_key(Admo::DIRECT,    Admo::DIRECT),     Idiom::IMP   },
+    /* Stone */
+    { Cell::to_op(Opcode::ADD, Modifier::AB), Cell::to_admo_key(Admo::IMMEDIATE, Admo::DIRECT),     Idiom::STONE },
+    { Cell::to_op(Opcode::MOV, Modifier::I),  Cell::to_admo_key(Admo::DIRECT,    Admo::INDIRECT_B), Idiom::STONE },
+    { Cell::to_op(Opcode::JMP, Modifier::B),  Cell::to_admo_key(Admo::DIRECT,    Admo::IMMEDIATE),  Idiom::STONE },
+    /* Paper */
+    { Cell::to_op(Opcode::MOV, Modifier::I),  Cell::to_admo_key(Admo::DIRECT,     Admo::POST_INC_B), Idiom::PAPER },
+    { Cell::to_op(Opcode::MOV, Modifier::I),  Cell::to_admo_key(Admo::POST_INC_A, Admo::POST_INC_B), Idiom::PAPER },
+    { Cell::to_op(Opcode::DJN, Modifier::B),  Cell::to_admo_key(Admo::DIRECT,     Admo::IMMEDIATE),  Idiom::PAPER },
+    { Cell::to_op(Opcode::DJN, Modifier::B),  Cell::to_admo_key(Admo::DIRECT,     Admo::DIRECT),     Idiom::PAPER },
+};
+static int constexpr count = sizeof(insts) / sizeof(insts[0]);
+static_assert(count <= UINT8_MAX, "Fused: handlers are indexed by a byte");
+
+/// Returns the fused handler of the instruction within the idiom (0: none)
+/// @param _cell instruction recognised as part of the idiom
+/// @param _idiom idiom recognised
+inline uint8_t find(Cell const &_cell, Idiom _idiom)
+{
+    for (int i = 1; i < count; i++)
+    {
+        if (insts[i].op == _cell.op() && insts[i].key == _cell.admo_key() && insts[i].idiom == _idiom)
+            return (uint8_t) i;
+    }
+    return 0;
+}
+
+} /* ::Fused */
+} /* ::OS */
@@ -0,0 +1,28 @@
+/// Compact image of the programs in a battle, copied into the core as blocks of packed instructions
+#pragma once
+
+#include <vector>
+#include "cell.hpp"
+
+namespace OS
+{
+/// Packed instructions of every program (normalised for the core), stored contiguously in slot order.
+/// Created once per game by Memory::create_image(), each round copies the blocks instead of packing each instruction
+struct Image
+{
+    std::vector<Asm::Cell> cells;   // packed instructions of every program
+    std::vector<int>       offsets; // [slot]: first cell of the program, [programs]: total cells
+
+    /// Returns the number of programs in the image
+    inline int programs() const { return offsets.empty() ? 0 : (int) offsets.size() - 1; }
+
+    /// Returns the number of packed instructions of the program
+    /// @param _slot program's slot
+    inline int len(int _slot) const { return offsets[_slot + 1] - offsets[_slot]; }
+
+    /// Returns the first packed instruction of the program
+    /// @param _slot program's slot
+    inline Asm::Cell const *program(int _slot) const { return cells.data() + offsets[_slot]; }
+};
+
+} /* ::OS */
@@ -0,0 +1,157 @@
+/// Runs independent battles of the same programs in lockstep, one battle in each lane of a shared core
+#pragma once
+
+#include <array>
+#include <utility>
+#include <vector>
+#include <stdint.h>
+#include "assembly.hpp"
+#include "memory.hpp"
+#include "scheduler.hpp"
+#include "report.hpp"
+
+/// Operating System handles: fetch/decode/execute cycle, memory simulator, and program processes
+namespace OS
+{
+/// Runs a battle of the same programs in each lane (e.g. every placement of a pairing), one cycle of every lane at a time.
+/// The core is a structure of arrays: each address is a row holding the cell of every lane side by side,
+/// so every phase of a cycle is a fixed length loop over the lanes (gathers, masked scatters, no branch
+/// on the lane's instruction), which the compiler may vectorise when built for AVX2 or AVX-512.
+///     [Fetch]   each lane's scheduler selects its process (per lane program counters)
+///     [Decode]  the operands of every lane are resolved together, branch-free
+///     [Execute] lanes are grouped by operation, each group runs the operation's kernel together:
+///               a lane which diverged from the others runs it alone (scalar fallback)
+/// Same results as CPU::run_fde_cycle() in every lane, the reports only contain the executing process
+/// @tparam Lanes number of battles in lockstep (8: AVX2, 16: AVX-512 words of 32-bit addresses)
+template<int Lanes>
+class LaneCPU
+{
+ public:
+    using LaneMask = uint32_t;  // bit [lane]: the lane is selected
+    static int constexpr lanes = Lanes;
+    static_assert(Lanes > 0 && Lanes <= 32, "LaneCPU: every lane must fit in a LaneMask");
+
+    /// Cells of every lane at a single address of the core (lane-interleaved)
+    struct Row
+    {
+        Cell lane[Lanes];
+    };
+
+ private:
+    C_RAM<Row> RAM;                         // lane-interleaved core (circular, run time size)
+    Row       *m_rows = nullptr;            // first row of the core, indexed directly by normalised addresses
+    int        m_size = 0;                  // number of memory addresses
+
+    std::array<Scheduler, Lanes> m_sched;   // process scheduler of each lane
+    std::array<Report, Lanes>    m_report;  // report of each lane's last cycle
+    LaneMask m_running = 0;                 // lanes with a round in progress
+
+    /* Cycle State (an entry per lane, reused every cycle) */
+    std::array<PCB, Lanes> m_process;       // executing process
+    alignas(64) int m_pc[Lanes]     = {},   // executing address (normalised)
+                    m_next[Lanes]   = {},   // next program counter of the executing process
+                    m_src[Lanes]    = {},   // address of the source (A operand)
+                    m_dest[Lanes]   = {},   // address of the destination (B operand)
+                    m_post_a[Lanes] = {},   // address post-incremented by the A operand (-1: none)
+                    m_post_b[Lanes] = {};   // address post-incremented by the B operand (-1: none)
+    alignas(64) uint8_t m_post_a_field[Lanes] = {},  // field post-incremented by the A operand (InstField)
+                        m_post_b_field[Lanes] = {};  // field post-incremented by the B operand (InstField)
+    LaneMask m_kill  = 0,                   // lanes whose executing process is killed (DAT, division by zero)
+             m_spawn = 0;                   // lanes whose executing process splits (SPL)
+
+    /* Stats */
+    long long m_cycles = 0,                 // lockstep cycles run
+              m_groups = 0;                 // execute groups run (one per distinct operation each cycle)
+
+    /// Returns the cell of the lane at a normalised address
+    inline Cell &lane_cell(int _lane, int _address) { return m_rows[_address].lane[_lane]; }
+
+    /// Returns the value normalised to [0, size), from [-size, 2 * size) (sums and differences of normalised values)
+    inline int wrap(int _val) const
+    {
+        _val -= m_size & -(int) (_val >= m_size);
+        return _val + (m_size & -(int) (_val < 0));
+    }
+
+    /// Resolves the operand of the executing instruction in every lane selected (same as Memory::decode_admo()),
+    /// pre-decrements are written to the selected lanes only
+    /// @tparam Field operand to resolve (A: source, B: destination)
+    /// @param _lanes lanes decoding this cycle
+    /// @param adr_ buffer for the address of each lane's operand
+    /// @param post_ buffer for the address post-incremented by each lane (-1: none)
+    /// @param post_field_ buffer for the field post-incremented by each lane
+    template<InstField Field>
+    void decode(LaneMask _lanes, int *adr_, int *post_, uint8_t *post_field_);
+
+    using Kernel = void (*)(LaneCPU &_cpu, LaneMask _group);   // execute phase of a single operation, every lane of a group
+
+    /// Executes a single (Opcode, Modifier) in every lane of the group (same as the CPU's kernels),
+    /// operand fields and modifier type are resolved at compile time
+    /// @tparam Code opcode
+    /// @tparam Mod  modifier
+    template<Opcode Code, Modifier Mod>
+    static void execute_kernel(LaneCPU &_cpu, LaneMask _group);
+
+    /// Returns a kernel for every operation key, indexed by Cell::op()
+    template<std::size_t... Op>
+    static constexpr std::array<Kernel, Cell::op_count> build_kernels(std::index_sequence<Op...>);
+
+    static const std::array<Kernel, Cell::op_count> kernel_table; // kernels, indexed by Cell::op()
+
+ public:
+    /// Creates a lane-interleaved core, every lane is idle until loaded
+    /// @param _size number of memory addresses within the core (see Memory::valid_size())
+    LaneCPU(int _size);
+
+    /// Loads a battle into the lane: resets the lane's addresses to (dat #0, #0), copies each program of the image
+    /// to its address, then resets the lane's scheduler (same state as Memory::load() and a new Scheduler)
+    /// @param _lane lane to load
+    /// @param _image packed programs, created by Memory::create_image() for a core of the same size
+    /// @param _programs collection of programs, the address of each program is set
+    /// @param _addresses address of the first instruction of each program
+    /// @param _max_cycles max number of cycles before the round has been concluded
+    /// @param _max_processes max number of processes a single program can create
+    void load(int _lane, Image const &_image, ProgramVec *_programs, std::vector<int> const &_addresses,
+              int _max_cycles, int _max_processes);
+
+ /* Execute */
+
+    /// Runs the next fetch/decode/execute cycle of every running lane
+    /// @return lanes still running after the cycle
+    LaneMask run_cycle();
+
+    /// Runs every lane to the end of its round
+    void run();
+
+ /* Utility */
+
+    /// Returns the number of memory addresses
+    inline int const &size() const { return m_size; }
+
+    /// Returns the lanes with a round in progress
+    inline LaneMask const &running() const { return m_running; }
+
+    /// Returns true if the lane's round is in progress
+    inline bool running(int _lane) const { return (m_running >> _lane) & 1; }
+
+    /// Returns the report of the lane's last cycle (program, status and normalised program counter only)
+    inline Report const &report(int _lane) const { return m_report[_lane]; }
+
+    /// Returns the scheduler of the lane
+    inline Scheduler const &scheduler(int _lane) const { return m_sched[_lane]; }
+
+    /// Returns the cell of the lane at the address
+    inline Cell const &cell(int _lane, int _address) const { return RAM[_address]->lane[_lane]; }
+
+    /// Returns the lockstep cycles run
+    inline long long const &cycles() const { return m_cycles; }
+
+    /// Returns the execute groups run, cycles() if the lanes never diverged
+    inline long long const &groups() const { return m_groups; }
+
+}; /* LaneCPU */
+
+extern template class LaneCPU<8>;
+extern template class LaneCPU<16>;
+
+} /* ::OS */
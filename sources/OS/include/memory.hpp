@@ -1,12 +1,19 @@
-/// Memory using circular RAM with assembly instruction objects and decoding functions
+/// Memory using circular RAM with packed assembly instructions and decoding functions
 #pragma once
 
 // #define MEMORY_DEBUG
 
+#include <array>
 #include <stdint.h>
-#include <time.h>
+#include <utility>
+#include <vector>
 #include "assembly.hpp"
+#include "cell.hpp"
+#include "random.hpp"
 #include "ctrl_unit.hpp"
+#include "decoder.hpp"
+#include "idiom.hpp"
+#include "image.hpp"
 #include "template/c_ram.hpp"
 
 namespace OS
@@ -14,19 +21,81 @@ namespace OS
 /// Memory Array Redcode Simulator (Memory): handles assembly instruction objects within RAM
 class Memory
 {
+ public:
+    /// Pre-decoded operands of a cell, valid while the cell holds the instruction it was compiled from
+    struct Compiled
+    {
+        uint64_t tag   = 0;     // inverted word of the instruction compiled (zeroed: never valid, no cell is all ones)
+        int      a_ptr = 0,     // A operand: address of the source (immediate, direct) or of its pointer (indirect)
+                 b_ptr = 0;     // B operand: same as a_ptr (-1: decoded by generate_registers())
+        uint8_t  fused = 0;     // fused handler of the idiom the cell is part of (see Fused::insts, 0: none)
+    };
+
  private:
-    static int constexpr ram_size = 8192;   // number of memory addresses within the core 
+    static int constexpr default_size = 8192;           // number of memory addresses, unless resized
+    static int constexpr max_ram_size = Cell::val_range; // operands must hold any address of the core
     int ini_min_seperation;                 // min distance between programs at the start of a round (config.ini) 
 
-    C_RAM<Inst> RAM;                        // Array of instruction objects (circular)
+    C_RAM<Cell> RAM;                        // Array of packed instructions (circular, run time size)
+    Random      m_rng;                      // places programs at random positions
+
+    /* Block Cache */
+    static int constexpr max_block_len = 16;    // max instructions compiled together (straight-line)
+
+    C_RAM<Compiled> m_blocks;               // [address]: pre-decoded operands of the cell (same size as the core)
+    long long       m_compiled = 0;         // blocks compiled since the core was allocated
+
+    /* Placement (buffers reused between rounds) */
+    std::vector<int> m_slack;               // [i]: free addresses before the i-th program clockwise (sorted)
+    std::vector<int> m_order;               // [i]: slot of the i-th program clockwise from the first program
 
  public:
     /// Initialises the simulator by loading a default asm instruction (dat #0, #0) into every address,
     /// then places each program at a random location in accordance with the 'min_seperation' setting
+    /// (see reset(), programs are spaced evenly if they can not be placed)
     /// @param _programs collection of programs to be loaded into the core
     /// @param _min_seperation minimum seperation between programs in the simulator
-    Memory(ProgramVec *_programs, int _min_seperation);
+    /// @param _seed seed for the random placement of programs
+    /// @param _size number of memory addresses within the core (see valid_size())
+    Memory(ProgramVec *_programs, int _min_seperation, uint64_t _seed, int _size = default_size);
     Memory();
+
+    /// Sets the number of memory addresses, the core is only reallocated (and cleared) if the size changes.
+    /// Cores of 1 MiB or more are pages committed on first touch, so memory grows with the addresses used
+    /// @param _size number of memory addresses within the core (see valid_size())
+    void resize(int _size);
+
+    /// Resets the core without reallocating it: every address is reset to (dat #0, #0),
+    /// then each program is placed at a random location (same placement as a new Memory).
+    /// Placement samples the free gaps directly: O(n log n), separation is measured around the core
+    /// @param _programs collection of programs to be loaded into the core
+    /// @param _min_seperation minimum seperation between programs in the simulator
+    /// @param _seed seed for the random placement of programs
+    /// @return false: the programs can not be placed 'min_seperation' apart, they are spaced evenly instead
+    bool reset(ProgramVec *_programs, int _min_seperation, uint64_t _seed);
+    /// Resets the core from the image of the programs (same placement as reset()), each program is a block copy
+    /// @param _image packed programs, created by create_image() from the same programs
+    /// @param _programs collection of programs, the address of each program is set
+    /// @param _min_seperation minimum seperation between programs in the simulator
+    /// @param _seed seed for the random placement of programs
+    /// @return false: the programs can not be placed 'min_seperation' apart, they are spaced evenly instead
+    bool reset(Image const &_image, ProgramVec *_programs, int _min_seperation, uint64_t _seed);
+
+    /// Reloads the core without reallocating it, resets every address to (dat #0, #0)
+    /// then places each program at the address given (no separation checks)
+    /// @param _programs collection of programs to be loaded into the core
+    /// @param _addresses address of the first instruction of each program
+    void load(ProgramVec *_programs, std::vector<int> const &_addresses);
+    /// Reloads the core from the image of the programs (same as load()), each program is a block copy
+    /// @param _image packed programs, created by create_image() from the same programs
+    /// @param _programs collection of programs, the address of each program is set
+    /// @param _addresses address of the first instruction of each program
+    void load(Image const &_image, ProgramVec *_programs, std::vector<int> const &_addresses);
+
+    /// Packs and normalises every program into the image (reuses the image's buffers)
+    /// @param _programs collection of programs to pack
+    /// @param image_ image to overwrite
+    void create_image(ProgramVec const *_programs, Image *image_) const;
     
  /* Decode */
 
@@ -35,22 +104,72 @@ class Memory
     /// @param exe_select selects operand A or B
     Register decode_admo(ControlUnit *_ctrl, InstField const exe_select);
 
-    /// Decodes the modifier for the input instruction
+    /// Decodes the modifier for the input instruction (pre-decoded table lookup),
+    /// swaps the operands, calling it again reverts the swaps
     /// @param _ctrl buffer for the decoded results
     void decode_modifier(ControlUnit * _ctrl);
-    /// Returns a control unit which has decoded the addressing modes and modifier
+    /// Decodes the addressing modes only into the control unit (overwritten in place),
+    /// the operand fields are left unswapped for the specialised kernels (modifier resolved at compile time)
+    /// @param ctrl_ control unit to decode into
+    /// @param _pc instruction register program counter to decode
+    void generate_registers(ControlUnit *ctrl_, int const _pc);
+    /// Decodes the addressing modes and modifier into the control unit (overwritten in place)
+    /// @param ctrl_ control unit to decode into
+    /// @param _pc instruction register program counter to decode
+    void generate_ctrl(ControlUnit *ctrl_, int const _pc);
+
+    /// Decodes the addressing modes into the control unit from the block cache (same registers as generate_registers()).
+    /// A cell is compiled once with the straight-line block it starts: the addresses of its operands are resolved,
+    /// so decoding is a call to the decoder of its addressing modes, without a modulo. Any write which changes
+    /// a compiled cell (MOV, arithmetic, pre-decrement, post-increment, a new round) invalidates it: each entry
+    /// keeps the instruction it was compiled from, checked on fetch instead of on every write
+    /// @param ctrl_ control unit to decode into
     /// @param _pc instruction register program counter to decode
-    ControlUnit generate_ctrl(int const _pc);
+    inline void generate_cached(ControlUnit *ctrl_, int const _pc)
+    {
+        int const index_ = RAM.loop_index(_pc);
+        generate_compiled(ctrl_, _pc, index_, compiled(index_));
+    }
+
+    /// Returns the pre-decoded operands of the cell, its block is compiled first if the cell changed since
+    /// (valid until the next write to the core)
+    /// @param _index normalised address of the cell
+    inline Compiled const &compiled(int const _index)
+    {
+        Compiled const &cmp_ = m_blocks.data()[_index];
+        if (cmp_.tag != ~RAM.data()[_index].word)
+            compile_block(_index);
+        return cmp_;
+    }
+
+    /// Decodes the addressing modes into the control unit from the pre-decoded operands (see generate_cached())
+    /// @param ctrl_ control unit to decode into
+    /// @param _pc instruction register program counter to decode
+    /// @param _index normalised address of the cell
+    /// @param _cmp pre-decoded operands of the cell, from compiled()
+    inline void generate_compiled(ControlUnit *ctrl_, int const _pc, int const _index, Compiled const &_cmp)
+    {
+        if (_cmp.b_ptr < 0)
+            generate_registers(ctrl_, _pc);
+        else
+            compiled_decoders[RAM.data()[_index].admo_key()](*this, ctrl_, _pc, _index, _cmp);
+    }
+
+    /// Decodes a compiled cell (same registers as generate_registers()), addressing modes resolved at compile time.
+    /// Inlined by the fused handlers of the CPU (see Idiom)
+    /// @tparam Key addressing key of the cell (see Cell::admo_key())
+    template<int Key>
+    static inline void decode_compiled(Memory &_memory, ControlUnit *ctrl_, int _pc, int _index, Compiled const &_cmp);
 
     /// Applies the post-increment if the pointer target exists 
     /// @param _ctrl control unit containing Registers to be incremented
     inline void apply_post_inc(ControlUnit &_ctrl)
     {
-        if (_ctrl.post_A != nullptr)
-            (*_ctrl.post_A)++;
+        if (_ctrl.post_A.cell != nullptr)
+            _ctrl.post_A.set(normalise(_ctrl.post_A.get() + 1));
 
-        if (_ctrl.post_B != nullptr)
-            (*_ctrl.post_B)++;
+        if (_ctrl.post_B.cell != nullptr)
+            _ctrl.post_B.set(normalise(_ctrl.post_B.get() + 1));
     }
 
     /// Reverts the modifiers and loops the address after the decoding process
@@ -62,41 +181,214 @@ class Memory
          _ctrl->SRC.address = RAM.loop_index(_ctrl->SRC.address );
         _ctrl->DEST.address = RAM.loop_index(_ctrl->DEST.address);
     }
+    /// Loops the executing address after the decoding process (registers from generate_registers())
+    /// @param _ctrl buffer for the encode after decoding
+    inline void encode_registers(ControlUnit *_ctrl)
+    {
+        _ctrl->EXE.address = RAM.loop_index(_ctrl->EXE.address);
+    }
 
  /* Utility */
 
     /// Returns the size of the simulator
-    static int constexpr size() { return ram_size; }
+    inline int const &size() const { return RAM.size(); }
 
-    /// access address of core simulators's memory array
-    Inst &operator[](int address) const;
-    /// modify address of core simulators's memory array
-    Inst &operator[](int address);
+    /// Returns the number of blocks compiled by generate_cached() since the core was allocated
+    inline long long const &compiled_blocks() const { return m_compiled; }
 
- private:
-    /// Generates a random positive integer using the process clock and xorshift algorithm
-    /// @param _max_range output will not exceed this value
-    uint32_t random_int(uint32_t max_range);
+    /// Returns the idiom recognised at the address by the block cache (NONE: not compiled, or not part of an idiom)
+    inline Idiom idiom(int address) const
+    {
+        int const index_ = RAM.loop_index(address);
+        Compiled const &cmp_ = m_blocks.data()[index_];
+        return (cmp_.tag == ~RAM.data()[index_].word) ? Fused::insts[cmp_.fused].idiom : Idiom::NONE;
+    }
+
+    /// Returns true if the core can be created with the number of memory addresses
+    /// @param _size number of memory addresses
+    static bool constexpr valid_size(int _size) { return _size >= 1 && _size <= max_ram_size; }
+
+    /// Returns the largest number of memory addresses (every address must fit in an operand)
+    static int constexpr max_size() { return max_ram_size; }
+
+    /// Returns true if the programs fit in a core at least 'min_seperation' apart (measured around the core)
+    /// @param _programs number of programs to place
+    /// @param _min_seperation minimum seperation between programs
+    /// @param _size number of memory addresses within the core
+    static bool constexpr placeable(int _programs, int _min_seperation, int _size)
+    {
+        return _programs <= 1 || (long long) _programs * _min_seperation <= _size;
+    }
+    /// Returns true if the programs fit in this core at least 'min_seperation' apart
+    inline bool placeable(int _programs, int _min_seperation) const
+    {
+        return placeable(_programs, _min_seperation, size());
+    }
+
+    /// Returns the value normalised to [0, size), every operand is normalised when written
+    /// @param _val value to normalise
+    inline int normalise(int _val) const { return RAM.loop_index(_val); }
 
-    /// Returns a pointer to either operand A or B values for the address given
+    /// Returns the instruction normalised for the core
+    /// @param _inst decoded instruction
+    inline Cell normalise(Inst const &_inst) const
+    {
+        Cell cell_ (_inst);
+        cell_.set_val(InstField::A, normalise(_inst.A.val));
+        cell_.set_val(InstField::B, normalise(_inst.B.val));
+        return cell_;
+    }
+
+    /// Returns the decoded instruction at the address of core simulators's memory array,
+    /// values over half the core size are shown as negative (e.g. 'dat #-1, #0')
+    inline Inst operator[](int address) const
+    {
+        Inst inst_ = RAM[address]->inst();
+        if (inst_.A.val > size() / 2) inst_.A.val -= size();
+        if (inst_.B.val > size() / 2) inst_.B.val -= size();
+        return inst_;
+    }
+
+    /// Hints the cache to load the instruction at the address (see prefetch_operands())
+    /// @param _pc program counter of an instruction about to be fetched
+    inline void prefetch(int _pc) const { RAM.prefetch(_pc); }
+
+    /// Hints the cache to load the cells the operands of the instruction point to (an indirect operand reads its pointer,
+    /// usually the warrior's own code, to prefetch the target), reads the instruction: prefetch() it first
+    /// @param _pc program counter of an instruction about to be decoded
+    inline void prefetch_operands(int _pc) const
+    {
+        Cell const &exe_ = *RAM[_pc];
+        prefetch_operand(_pc, exe_.admo(InstField::A), exe_.val(InstField::A));
+        prefetch_operand(_pc, exe_.admo(InstField::B), exe_.val(InstField::B));
+    }
+
+    /// access packed instruction at the address of core simulators's memory array
+    inline Cell const &cell(int address) const { return *RAM[address]; }
+    /// modify packed instruction at the address of core simulators's memory array
+    inline Cell &cell(int address)             { return *RAM[address]; }
+
+ private:
+    /// Returns a reference to either operand A or B values for the address given,
+    /// values are already normalised so reading is a plain load
     /// @param address instruction address within the Memory
     /// @param select selects operand A or B
-    inline int *fetch_operand(int address, InstField select)
+    inline OperandRef fetch_operand(int address, InstField select)
     {
-        static int constexpr max_itr = 8,                       // max RAM address loop iterations
-                             itr_limiter = ram_size * max_itr; // adjusts value over limit 
+        return { RAM[address], select };
+    }
 
-        int *operand = select == InstField::A ? &RAM[address]->A.val    // A
-                                              : &RAM[address]->B.val;   // B
+    /// Hints the cache to load the target of a single operand (see prefetch_operands())
+    inline void prefetch_operand(int _pc, Admo _admo, int _val) const
+    {
+        if (_admo == Admo::IMMEDIATE)
+            return;
 
-        // loop value to limiter bounds: stops Integer overflow,
-        // and increases RAM indexing performance
-        while (*operand < -(itr_limiter) ) *operand += itr_limiter;    // lower bound
-        while (*operand >   itr_limiter  ) *operand -= itr_limiter;    // upper bound
+        int const ptr_ = _pc + _val;
+        if (_admo == Admo::DIRECT)
+        {
+            RAM.prefetch(ptr_);
+            return;
+        }
+        // odd modes point through the B field ('@', '<', '>')
+        InstField const field_ = ((int) _admo & 1) ? InstField::B : InstField::A;
+        RAM.prefetch(ptr_ + RAM[ptr_]->val(field_));
+    }
 
-        return operand;
+    /// Returns the sum of two normalised values (or a normalised value - 1) normalised to [0, size), without a modulo
+    inline int wrap(int _val) const
+    {
+        _val -= size() & -(int) (_val >= size());
+        return _val + (size() & -(int) (_val < 0));
     }
 
+ /* Block Cache */
+
+    using CompiledDecoder = void (*)(Memory &_memory, ControlUnit *ctrl_, int _pc, int _index, Compiled const &_cmp);
+
+    /// Compiles the straight-line block from the address: every instruction until one which may not continue
+    /// to the next address (jump, skip, SPL, DAT), an already compiled cell, or max_block_len instructions.
+    /// Each cell of an idiom is given the fused handler of its instruction (see recognise())
+    /// @param _index normalised address of the first instruction
+    void compile_block(int _index);
+
+    /// Returns the fused handler of the cell if it is part of an idiom around it (0: none, see Idiom).
+    /// A handler only depends on its own cell, which is checked on fetch: a write to another cell of the idiom
+    /// leaves the handler valid (same results), the idiom is recognised again when the block is recompiled
+    /// @param _index normalised address of the cell
+    uint8_t recognise(int _index) const;
+
+    /// Decodes a compiled operand into the register (same as decode_admo()), applies its pre-decrement
+    /// @tparam _Admo addressing mode of the operand
+    /// @param reg_ register to overwrite
+    /// @param _ptr address of the operand's source or pointer (see Compiled)
+    /// @param post_ buffer for the value post-incremented by the operand
+    template<Admo _Admo>
+    inline void decode_operand(Register *reg_, int _ptr, OperandRef *post_);
+
+    /// Returns a decoder for every addressing key, indexed by Cell::admo_key()
+    template<std::size_t... Key>
+    static constexpr std::array<CompiledDecoder, Cell::admo_count> build_decoders(std::index_sequence<Key...>);
+
+    static const std::array<CompiledDecoder, Cell::admo_count> compiled_decoders; // indexed by Cell::admo_key()
+
+    /// Resets every address to (dat #0, #0), the RAM is only allocated on first use (default size)
+    void clear();
+
+    /// Clears the core, then sets a random address for each program in accordance with the 'min_seperation' setting
+    /// (the programs are not copied into the core)
+    /// @param _programs collection of programs to place
+    /// @param _min_seperation minimum seperation between programs in the simulator
+    /// @param _seed seed for the random placement of programs
+    /// @return false: the programs can not be placed, they are spaced evenly instead
+    bool place(ProgramVec *_programs, int _min_seperation, uint64_t _seed);
+
+    /// Clears the core, then sets the address given for each program (no separation checks)
+    /// @param _programs collection of programs to place
+    /// @param _addresses address of the first instruction of each program
+    void place(ProgramVec *_programs, std::vector<int> const &_addresses);
+
+    /// Packs each instruction of the program into the core at the program's address
+    /// @param _program placed program
+    void copy_program(Program const &_program);
+
 
 }; /* ::Memory */
+
+template<Admo _Admo>
+inline void Memory::decode_operand(Register *reg_, int _ptr, OperandRef *post_)
+{
+    Cell *cells_ = RAM.data();
+    if constexpr (_Admo == Admo::IMMEDIATE || _Admo == Admo::DIRECT)
+    {
+        reg_->load(_ptr, cells_ + _ptr);
+    }
+    else
+    {
+        // odd modes point through the B field ('@', '<', '>')
+        constexpr InstField field_ = ((int) _Admo & 1) ? InstField::B : InstField::A;
+        Cell &ptr_ = cells_[_ptr];
+
+        if constexpr (_Admo == Admo::PRE_DEC_A || _Admo == Admo::PRE_DEC_B)
+            ptr_.set_val(field_, wrap(ptr_.val(field_) - 1));
+        if constexpr (_Admo == Admo::POST_INC_A || _Admo == Admo::POST_INC_B)
+            *post_ = { &ptr_, field_ };
+
+        int const adr_ = wrap(_ptr + ptr_.val(field_));
+        reg_->load(adr_, cells_ + adr_);
+    }
+} /* decode_operand() */
+
+template<int Key>
+inline void Memory::decode_compiled(Memory &_memory, ControlUnit *ctrl_, int _pc, int _index, Compiled const &_cmp)
+{
+    // registers are stored in place: a copy of a temporary reloads fields still being stored (store forwarding stalls)
+    ctrl_->EXE.load(_pc, _memory.RAM.data() + _index);
+    ctrl_->post_A.cell = nullptr;
+    ctrl_->post_B.cell = nullptr;
+
+    _memory.decode_operand<Cell::key_admo_a(Key)>(&ctrl_->SRC,  _cmp.a_ptr, &ctrl_->post_A);
+    _memory.decode_operand<Cell::key_admo_b(Key)>(&ctrl_->DEST, _cmp.b_ptr, &ctrl_->post_B);
+} /* decode_compiled() */
+
 } /* ::OS */
@@ -0,0 +1,19 @@
+/// Observer policies of the CPU: select at compile time what is tracked during a cycle
+#pragma once
+
+namespace OS
+{
+/// Tracks nothing: events and the report's register logs are compiled away (headless runs),
+/// the report only contains the executing process (program, status and program counter)
+struct NullObserver
+{
+    static bool constexpr events = false;   // track READ/WRITE/EXECUTE/ILLEGAL events
+};
+
+/// Tracks every event and records a full report each cycle (used by the GUI's memory viewer)
+struct ReportObserver
+{
+    static bool constexpr events = true;    // track READ/WRITE/EXECUTE/ILLEGAL events
+};
+
+} /* ::OS */
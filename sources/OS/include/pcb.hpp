@@ -7,24 +7,27 @@
 /// Operating System handles: fetch/decode/execute cycle, memory simulator, and program processes
 namespace OS {
 
+/// Dense index of a program (0..N-1, in load order), keys every per-cycle table
+using Slot = int;
+
 /// Process Control Block: represents a process with a parent ID, status, and program counter
 class PCB
 {
  private:
-    UUID    m_parent_id;      // UUID of the process's parent
+    Slot    m_parent;         // slot of the process's parent program
     int     m_pc;             // program counter: holds address of next instruction to be executed
     Status  m_status;         // current execution status
 
  public:
     /// Creates a process
-    /// @param _parent_ID UUID of the process's parent
+    /// @param _parent slot of the process's parent program
     /// @param _pc_initial initial program counter address 
-    PCB(UUID _parent_ID, int _pc_initial);
+    PCB(Slot _parent, int _pc_initial);
     PCB();
 
  /* Utility */
 
-    inline UUID   parent_id()          const { return m_parent_id; }
+    inline Slot   parent()             const { return m_parent;    }
     inline Status status()             const { return m_status;    }
     inline void   set_status(Status _status) { m_status = _status; }
 
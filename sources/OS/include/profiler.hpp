@@ -0,0 +1,152 @@
+/// Instrumentation of the CPU's cycles: instruction counts, instruction mix and sampled latencies
+#pragma once
+
+// #define CPU_PROFILE     // instruments CPU::run_fde_cycle(), compiled away (no cost) unless defined
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "assembly.hpp"
+#include "cell.hpp"
+#include "pcb.hpp"
+
+namespace OS
+{
+namespace /* {anonymous} */ { using namespace Asm; }
+
+/// Records where the cycles of a CPU go, attached with CPU::profile() (only recorded if built with CPU_PROFILE):
+///     [Counts]  executed instructions per (Opcode, Modifier, Admo A, Admo B)
+///     [Mix]     executed instructions per opcode of each program
+///     [Latency] decode and execute times of one cycle in sample_period (log2 histograms, nanoseconds)
+class Profiler
+{
+ public:
+    #ifdef CPU_PROFILE
+    static bool constexpr enabled = true;
+    #else
+    static bool constexpr enabled = false;  // CPU::run_fde_cycle() records nothing
+    #endif
+
+    static int constexpr sample_period  = 64;   // cycles per latency sample
+    static int constexpr opcode_count   = 16;   // opcodes in the instruction mix (see Opcode)
+    static int constexpr bucket_count   = 32;   // [i]: latencies of [2^(i-1), 2^i) ns, [0]: under 1 ns
+
+    /// Log2 histogram of sampled latencies
+    struct Histogram
+    {
+        std::array<long long, bucket_count> buckets = {};
+        long long samples  = 0,     // latencies recorded
+                  total_ns = 0;     // sum of the latencies recorded
+
+        /// Records a latency into its bucket
+        /// @param _ns latency in nanoseconds
+        inline void add(long long _ns)
+        {
+            int bucket_ = 0;
+            while (bucket_ < bucket_count - 1 && (1LL << bucket_) <= _ns)
+            {
+                bucket_++;
+            }
+            buckets[bucket_]++;
+            samples++;
+            total_ns += _ns;
+        }
+
+        /// Returns the mean latency (0: no samples)
+        inline double mean() const { return samples ? (double) total_ns / samples : 0.0; }
+
+        /// Returns the upper bound of the bucket holding the percentile (ns, 0: no samples)
+        /// @param _percent percentile [0, 100]
+        long long percentile(double _percent) const;
+    };
+
+ private:
+    std::vector<long long> m_counts;    // [Cell::op() * Cell::admo_count + Cell::admo_key()]: executed instructions
+    std::vector<std::array<long long, opcode_count>> m_mix; // [program][Opcode]: executed instructions
+    Histogram m_decode,                 // sampled decode latencies (block cache, generate_registers())
+              m_execute;                // sampled execute latencies (kernels)
+    long long m_cycles  = 0;            // cycles recorded
+    long long m_clock   = 0;            // cost of reading the clock (ns), removed from every latency
+    int       m_sample  = 0;            // cycles until the next sample
+
+ public:
+    /// Creates a profiler of the programs (nothing is allocated unless enabled)
+    /// @param _programs number of programs (instruction mixes)
+    Profiler(int _programs);
+    Profiler();
+
+    /// Clears every count and histogram, measures the cost of reading the clock again (no effect unless enabled)
+    /// @param _programs number of programs (instruction mixes)
+    void reset(int _programs);
+
+    /// Returns the time of a sample (steady clock, nanoseconds)
+    static inline long long now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count();
+    }
+
+ /* Record */
+
+    /// Records an executed instruction, returns true if the cycle's latencies are sampled
+    /// @param _program slot of the program executing the instruction
+    /// @param _cell instruction executed (before its execution)
+    inline bool record(Slot _program, Cell const &_cell)
+    {
+        m_counts[_cell.op() * Cell::admo_count + _cell.admo_key()]++;
+        m_mix[_program][(int) _cell.code()]++;
+        m_cycles++;
+
+        if (--m_sample > 0)
+            return false;
+        m_sample = sample_period;
+        return true;
+    }
+
+    /// Records the decode latency of a sampled cycle (measured between two now(), the clock's cost is removed)
+    inline void record_decode(long long _ns)  { m_decode.add(std::max(_ns - m_clock, 0LL));  }
+    /// Records the execute latency of a sampled cycle (measured between two now(), the clock's cost is removed)
+    inline void record_execute(long long _ns) { m_execute.add(std::max(_ns - m_clock, 0LL)); }
+
+ /* Utility */
+
+    /// Returns the number of cycles recorded
+    inline long long const &cycles() const { return m_cycles; }
+
+    /// Returns the cost of reading the clock (ns), the least time measured between two now()
+    inline long long const &clock_cost() const { return m_clock; }
+
+    /// Returns the executed instructions of the (Opcode, Modifier, Admo A, Admo B) (0 unless enabled)
+    inline long long count(Opcode _code, Modifier _mod, Admo _a, Admo _b) const
+    {
+        if constexpr (!enabled)
+            return 0;
+        return m_counts[Cell::to_op(_code, _mod) * Cell::admo_count + Cell::to_admo_key(_a, _b)];
+    }
+
+    /// Returns the executed instructions of the opcode by the program (0 unless enabled)
+    inline long long mix(Slot _program, Opcode _code) const
+    {
+        if constexpr (!enabled)
+            return 0;
+        return m_mix[_program][(int) _code];
+    }
+
+    /// Returns the number of programs (instruction mixes)
+    inline int programs() const { return m_mix.size(); }
+
+    /// Returns the sampled decode latencies
+    inline Histogram const &decode() const  { return m_decode;  }
+    /// Returns the sampled execute latencies
+    inline Histogram const &execute() const { return m_execute; }
+
+    /// Returns a text dump of the counts (most executed first), instruction mixes and latencies (empty unless enabled)
+    /// @param _max_counts max (Opcode, Modifier, Admo A, Admo B) rows
+    std::string to_string(int _max_counts = 16) const;
+
+}; /* Profiler */
+
+} /* ::OS */
@@ -0,0 +1,54 @@
+/// Pseudo random number generator, each instance is an independent sequence
+#pragma once
+
+#include <stdint.h>
+
+namespace OS
+{
+/// SplitMix64 pseudo random number generator, holds no shared state so it is safe to use per game.
+/// The same seed (and stream) always produces the same sequence
+class Random
+{
+ private:
+    static uint64_t constexpr golden_gamma = 0x9E3779B97F4A7C15; // state increment (odd, so every state is visited)
+    uint64_t m_state;                                            // mutates on each call
+
+ public:
+    /// Scrambles a value, the output of the SplitMix64 algorithm
+    /// @param _value value to scramble
+    static inline uint64_t constexpr mix(uint64_t _value)
+    {
+        _value = (_value ^ (_value >> 30)) * 0xBF58476D1CE4E5B9;
+        _value = (_value ^ (_value >> 27)) * 0x94D049BB133111EB;
+        return _value ^ (_value >> 31);
+    }
+
+    /// Returns the seed of an independent sequence derived from a seed, e.g. each battle of a tournament
+    /// @param _seed   seed the streams are derived from
+    /// @param _stream index of the stream
+    static inline uint64_t constexpr stream(uint64_t _seed, uint64_t _stream)
+    {
+        return mix(_seed ^ mix(_stream + golden_gamma));
+    }
+
+    /// Creates a generator
+    /// @param _seed initial state of the sequence
+    Random(uint64_t _seed = 0) { seed(_seed); }
+
+    /// Restarts the sequence using the seed given
+    /// @param _seed initial state of the sequence
+    inline void seed(uint64_t _seed) { m_state = _seed; }
+
+    /// Returns the next number in the sequence (SplitMix64 algorithm)
+    inline uint64_t next()
+    {
+        m_state += golden_gamma;
+        return mix(m_state);
+    }
+
+    /// Returns the next number in the sequence, within the range given
+    /// @param _max_range output will not exceed this value
+    inline uint32_t next(uint32_t _max_range) { return next() % _max_range; }
+};
+
+} /* ::OS */
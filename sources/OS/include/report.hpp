@@ -15,7 +15,7 @@ struct Report
         Event event;    // instruction event
     };
 
-    UUID program_id;    // executing program UUID
+    Slot program;       // executing program slot
     Status status;      // m_status of the execution
 
     int next_pc;
@@ -26,8 +26,17 @@ struct Report
     /// Generates a report from the OS detailing its last FDE cycle
     /// @param _process executing process
     /// @param _ctrl control unit containing registers (exe, src, and dest
-    Report(PCB &_process, ControlUnit &_ctrl);
+    Report(PCB const &_process, ControlUnit const &_ctrl);
     Report();
+
+    /// Overwrites the executing process details of the report (program, status and program counter)
+    /// @param _process executing process
+    void record_process(PCB const &_process);
+
+    /// Overwrites the report with the details of the last FDE cycle
+    /// @param _process executing process
+    /// @param _ctrl control unit containing registers (exe, src, and dest)
+    void record(PCB const &_process, ControlUnit const &_ctrl);
 };
 
 } /* ::OS */
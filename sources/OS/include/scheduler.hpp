@@ -5,7 +5,7 @@
 //  #define SCHEDULER_DEBUG_ADD_PCB
 //  #define SCHEDULER_DEBUG_KILL_PCB
 
-#include <unordered_map>
+#include <vector>
 #include "assembly.hpp"
 #include "pcb.hpp"
 #include "template/queue.hpp"
@@ -16,36 +16,48 @@ namespace OS {
 
 namespace /* {anonymous} */
 {
-    using PrcsQueue = Queue<PCB>;                           // Queue of scheduled processes
-    using Schedules = std::unordered_map<UUID, PrcsQueue>;  // Hashtable of schedules
+    using PrcsQueue = Queue<int>;               // Queue of scheduled processes (program counters)
+    using Schedules = std::vector<PrcsQueue>;   // schedule of each program, indexed by slot
 }
 
 /// Manages processes using a queue of PCBs for each program
 class Scheduler
 {
  private:
-    int ini_max_cycles,         // max number of cycles before the round has been concluded
-        ini_max_processes;      // max number of processes a single program can create
-    int m_cycles;               // cycles executed
-    int mutable m_total_prcs;   // total running processes
+    int ini_max_cycles    = 0,  // max number of cycles before the round has been concluded
+        ini_max_processes = 0;  // max number of processes a single program can create
+    int m_cycles          = 0;  // cycles executed
+    int m_total_prcs      = 0;  // total live processes (updated on spawn and death only)
+    std::vector<int> m_prcs;    // live processes of each program slot (including the executing process)
 
-    Schedules schedules_tbl;    // hosts a queue of processes for each program
-    RoundRobin<UUID> RR;        // A Round Robin System which manages its position rotation
+    Schedules schedules_tbl;    // hosts a queue of processes for each program slot (fixed capacity: max processes)
+    RoundRobin<Slot> RR;        // A Round Robin System which manages its position rotation
+
+    /// Returns true if the slot belongs to a program
+    inline bool const has_slot(Slot _slot) const { return _slot >= 0 && _slot < (int) schedules_tbl.size(); }
 
  public:
     /// Create a process scheduler using a PCB queue for each program
-    /// @param _programs collection of all the programs
+    /// @param _programs collection of all the programs (the index of a program is its slot)
     /// @param _cycles max number of cycles before the round has been concluded
     /// @param _processes max number of processes a single program can create
     Scheduler(Asm::ProgramVec *_programs, int _max_cycles, int _max_processes);
     Scheduler();
 
+    /// Resets the scheduler to a new round without reallocating it: the queues are emptied,
+    /// then each program is given an initial process (same state as a new Scheduler).
+    /// The queues are only rebuilt if the number of programs or the max processes changed
+    /// @param _programs collection of all the programs (the index of a program is its slot)
+    /// @param _cycles max number of cycles before the round has been concluded
+    /// @param _processes max number of processes a single program can create
+    void reset(Asm::ProgramVec *_programs, int _max_cycles, int _max_processes);
+
  /* Fetch */
 
     /// Creates a new process and sets the initial program counter
-    /// @param _parent parent of the process
+    /// @param _parent slot of the parent program
     /// @param _pc_initial program counter's initial address, where the first instruction is read
-    void add_process(UUID _parent, int _pc_initial);
+    void add_process(Slot _parent, int _pc_initial);
 
     /// Kills the process
     /// @param _process process to kill
@@ -53,6 +65,16 @@ class Scheduler
 
     /// Returns the next process from the queue
     PCB fetch_next();
+    /// Overwrites the process buffer with the next process from the queue
+    /// @param process_ buffer for the next process
+    void fetch_next(PCB *process_);
+
+    /// Returns the program counter of the process the next fetch will return (the scheduler is unchanged)
+    inline int next_pc() const
+    {
+        Slot const slot_ = RR.peek();
+        return has_slot(slot_) ? schedules_tbl[slot_].front() : 0;
+    }
 
     /// Returns the process to the queue
     /// @param _process existing process to return
@@ -72,27 +94,14 @@ class Scheduler
     /// Returns number of programs program
     inline int const &programs() const { return RR.len(); }
 
-    /// Returns the total number of processes
-    inline int const &processes() const
-    {
-        m_total_prcs = 0;
-        for (int i = 0; i < programs(); i++)
-        {
-            m_total_prcs += schedules_tbl.at(RR.next()).size();
-        }
-        return m_total_prcs;
-    }
+    /// Returns the total number of live processes
+    inline int const &processes() const { return m_total_prcs; }
 
-    /// Returns the number of processes for a specific UUID
-    /// @param _uuid parents's ID
-    inline int const processes(UUID _uuid) const
-    { 
-        int processes_ = 0;
-        if (schedules_tbl.count(_uuid))
-        {
-            processes_ = schedules_tbl.at(_uuid).size();
-        }
-        return processes_;
+    /// Returns the number of live processes for a specific program
+    /// @param _slot program's slot
+    inline int const processes(Slot _slot) const
+    {
+        return has_slot(_slot) ? m_prcs[_slot] : 0;
     }
 };/* Scheduler */
 
@@ -1,42 +1,172 @@
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <type_traits>
+#include <stdint.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define C_RAM_PAGED     // large arrays are mapped pages (page aligned, committed on first touch)
+#endif
 
 /// Circular Random Access Memory: contains an array of T objects
+/// @tparam T object stored at each memory address
 template<typename T>
 struct C_RAM
 {
- using RAM_PTR = std::unique_ptr<T[]>; // Unique Ptr to the systems RAM
  private:
-    int m_size;     // number of memory addresses
-    RAM_PTR m_ram;  // array of memory addresses
+    /// Arrays of at least this many bytes are zeroed pages mapped from the system, only committed once touched
+    /// (trivially copyable objects only, which must be valid when zeroed)
+    static std::size_t constexpr paged_bytes = std::size_t(1) << 20;
+
+    /// Frees the array of memory addresses (unmaps the pages of a paged array)
+    struct Release
+    {
+        std::size_t pages = 0;  // bytes mapped, 0 if allocated with new[]
+
+        inline void operator()(T *_ram) const
+        {
+            #ifdef C_RAM_PAGED
+            if (pages)
+            {
+                munmap(_ram, pages);
+                return;
+            }
+            #endif
+            delete[] _ram;
+        }
+    };
+    using RAM_PTR = std::unique_ptr<T[], Release>; // Unique Ptr to the systems RAM
+
+    /// Modulo of a run time size, the common core sizes are reduced by a constant
+    enum class Modulo : uint8_t { MASK, CORE_8000, CORE_55440, FAST };
+
+    int m_size = 0;         // number of memory addresses
+    RAM_PTR m_ram;          // array of memory addresses
+
+    /* Address Wrapping */
+    Modulo   m_modulo  = Modulo::FAST;
+    uint32_t m_mask    = 0; // size - 1, if the size is a power of two
+    uint64_t m_fastmod = 0; // precomputed reciprocal of the size (fast modulo)
+    uint32_t m_wrap    = 0; // 2^32 % size, corrects the modulo of negative addresses
+
+    /// Returns the address modulo a size known at compile time (compiled to a multiply)
+    template<int N>
+    static inline int const_index(int address)
+    {
+        int const index_ = address % N;
+        return index_ + (N & -(int) (index_ < 0));
+    }
+
+    /// Returns a new array of memory addresses, large arrays of trivially copyable objects are zeroed pages
+    static RAM_PTR allocate(int _size)
+    {
+        #ifdef C_RAM_PAGED
+        if constexpr (std::is_trivially_copyable<T>::value)
+        {
+            std::size_t const bytes_ = (std::size_t) _size * sizeof(T);
+            if (bytes_ >= paged_bytes)
+            {
+                void *pages_ = mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (pages_ != MAP_FAILED)
+                    return RAM_PTR((T *) pages_, Release { bytes_ });
+            }
+        }
+        #endif
+        return RAM_PTR(new T[_size], Release {});
+    }
 
  public:
     /// Creates an array of memory addresses of type <T>
-    C_RAM(int const _size) 
+    /// @param _size number of memory addresses
+    C_RAM(int const _size)
     {
-        m_size = _size;
-        m_ram = RAM_PTR(new T[m_size]);
+        m_size    = _size;
+        m_ram     = allocate(m_size);
+        m_mask    = m_size - 1;
+        m_modulo  = ((m_size & m_mask) == 0) ? Modulo::MASK       :
+                    (m_size == 8000)         ? Modulo::CORE_8000  :
+                    (m_size == 55440)        ? Modulo::CORE_55440 : Modulo::FAST;
+        m_fastmod = UINT64_C(0xFFFFFFFFFFFFFFFF) / (uint32_t) m_size + 1;
+        m_wrap    = (uint32_t) ((UINT64_C(1) << 32) % (uint32_t) m_size);
     }
     C_RAM() = default;
 
-    /// Loops the address when outside the bounds of RAM
+    /// Loops the address when outside the bounds of RAM: a mask, a constant for the common sizes,
+    /// else without division (Lemire fast modulo). The size is fixed for a match, so the branch is always predicted
     /// @param address RAM address
     inline int loop_index(int address) const
     {
-        // loop address until it is within the 
-        while (address < 0 || address >= m_size)
+        switch (m_modulo)
         {
-            
-            if (address < 0)        // address -> upper bounds (m_size)
-            {
-                address += m_size;
-            }
-            else address -= m_size; // address -> lower bounds (0)
+            case Modulo::MASK:       return address & m_mask;
+            case Modulo::CORE_8000:  return const_index<8000>(address);
+            case Modulo::CORE_55440: return const_index<55440>(address);
+            default: break;
         }
-        return address;
+
+        uint32_t const unsigned_ = (uint32_t) address;
+        #ifdef __SIZEOF_INT128__
+        uint32_t index_ = (uint32_t) (((__uint128_t) (m_fastmod * unsigned_) * (uint32_t) m_size) >> 64);
+        #else
+        uint32_t index_ = unsigned_ % (uint32_t) m_size;
+        #endif
+
+        // negative: remove the 2^32 added by the unsigned cast
+        int result_ = (int) index_ - (int) (m_wrap & -(uint32_t) (address < 0));
+        return result_ + (m_size & -(int) (result_ < 0));
     }
-    
+
     /// Returns the number of memory addresses
-    inline int size() const { return m_size; };
+    inline int const &size() const { return m_size; };
+
+    /// Returns true if the array of memory addresses has been allocated
+    inline bool allocated() const { return m_ram != nullptr; }
+
+    /// Returns true if the array is made of pages mapped from the system (committed on first touch)
+    inline bool paged() const { return m_ram.get_deleter().pages != 0; }
+
+    /// Overwrites every memory address with a copy of the value (no reallocation)
+    /// @param _value object to copy into each address
+    inline void fill(T const &_value) { std::fill_n(m_ram.get(), m_size, _value); }
+
+    /// Zeroes every memory address (no reallocation), the pages of a paged array are returned to the system
+    /// and zeroed again on their next touch. Only for trivially copyable objects, which must be valid when zeroed
+    inline void clear()
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "C_RAM::clear() zeroes the objects");
+
+        #if defined(C_RAM_PAGED) && defined(__linux__)
+        if (paged() && madvise(m_ram.get(), m_ram.get_deleter().pages, MADV_DONTNEED) == 0)
+            return;
+        #endif
+        std::memset((void *) m_ram.get(), 0, (std::size_t) m_size * sizeof(T));
+    }
+
+    /// Copies a block of objects into RAM from the address, wrapping around the end of the array
+    /// @param _src first object of the block
+    /// @param _len number of objects in the block (at most the size of RAM)
+    /// @param address RAM address of the first object
+    inline void copy(T const *_src, int _len, int address)
+    {
+        int const begin_ = loop_index(address),
+                  head_  = std::min(_len, m_size - begin_);   // objects before the end of the array
+
+        std::copy_n(_src,         head_,        &m_ram[begin_]);
+        std::copy_n(_src + head_, _len - head_, &m_ram[0]);
+    }
+
+    /// Hints the cache to load the memory address (no effect on the contents, ignored by other compilers)
+    /// @param address RAM address
+    inline void prefetch(int address) const
+    {
+        #if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(&m_ram[loop_index(address)]);
+        #endif
+    }
+
+    /// Returns the first memory address, for addresses already within [0, size) (no filtering)
+    inline T *data() const { return m_ram.get(); }
 
     /// Access address of RAM's memory array (filters address)
     T *const operator[](int address) const { return &m_ram[loop_index(address)]; }
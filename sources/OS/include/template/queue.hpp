@@ -1,111 +1,79 @@
-/// Queue of nodes containing data <T>
-template <typename T> 
+#include <memory>
+
+/// Fixed capacity queue of elements <T>, stored contiguously in a ring buffer
+/// (allocated once on creation, enqueue/dequeue never allocate)
+template <typename T>
 class Queue
 {
  private:
-    /// Containts data and pointer to the next|previous node
-    struct Node
+    std::unique_ptr<T[]> m_ring;    // ring buffer of elements
+    int m_capacity,                 // max number of elements in the queue
+        m_size,                     // current size of the queue
+        m_front;                    // index of the element at the front of the queue
+
+    /// Returns the ring buffer index, offset from the front of the queue
+    inline int index(int _offset) const
     {
-        T data;     // data of type <T>
-        Node *prev, // previous node in queue
-             *next; // next     node in queue
-        
-        /// Creates a new node containing data <T>
-        /// @param _data element to store in the node
-        Node(T _data)
-        {
-            data = _data;
-            prev = nullptr;
-            next = nullptr;
-        }
-    };
-    
-    bool m_empty;   // empty queue flag
-    int   m_size;   // current size of the queue
-    Node *m_front,  // node at the front of the queue
-         *m_back;   // node at the back  of the queue
+        int const index_ = m_front + _offset;
+        return (index_ < m_capacity) ? index_ : index_ - m_capacity;
+    }
 
  public:
     /// Creates a queue to contain elements
-    Queue()
+    /// @param _capacity max number of elements in the queue
+    Queue(int _capacity = 0)
     {
-        m_empty  = true;
-        m_size   = 0;
-        m_front  = nullptr;
-        m_back   = nullptr;
+        m_capacity = (_capacity > 0) ? _capacity : 0;
+        m_size     = 0;
+        m_front    = 0;
+        m_ring     = std::unique_ptr<T[]>(m_capacity ? new T[m_capacity] : nullptr);
     }
-    /// Deletes the queue & all nodes 
-    ~Queue() { while (this->dequeue()); }
-    
+
     /// Returns the size of the queue
     inline int size()       const { return m_size; }
+    /// Returns the max number of elements in the queue
+    inline int capacity()   const { return m_capacity; }
     /// Returns true if the queue is empty
-    inline bool is_empty()   const { return m_empty; }
+    inline bool is_empty()  const { return m_size == 0; }
+    /// Returns true if the queue is full
+    inline bool is_full()   const { return m_size == m_capacity; }
 
     /// Returns the element at the front of the queue (copy)
-    inline T const front() { return !is_empty() ? m_front->data : T(); }
-    /// Returns the element at the front of the queue (copy)
-    inline T const back()  { return !is_empty() ? m_back->data  : T(); }
-    
-    /// Enqueue a new node with the stored data to the back of the queue
-    /// @param _data to store inside the node
-    inline void enqueue(T _data)
+    inline T const front() const { return !is_empty() ? m_ring[m_front]             : T(); }
+    /// Returns the element at the back of the queue (copy)
+    inline T const back()  const { return !is_empty() ? m_ring[index(m_size - 1)]   : T(); }
+
+    /// Removes every element (keeps the ring buffer)
+    inline void clear()
     {
-        Node *node = new Node(_data);
-        
-        // queue is empty
-        if (is_empty())
-        {
-            m_front = node;
-            m_back  = m_front; // new node is only element in queue
+        m_size  = 0;
+        m_front = 0;
+    }
 
-            m_size++;
-            m_empty = false;
-            return;
-        }
+    /// Enqueue a copy of the data to the back of the queue
+    /// @param _data element to store
+    /// @return false: the queue is full and the element was dropped
+    inline bool enqueue(T const &_data)
+    {
+        if (is_full()) return false;
 
-        // contains multiple elements
-        if (m_back != m_front)
-        {
-            node->next = m_back; // link new node to list
-            m_back->prev = node; // set previous node
-            m_back       = node; // update back node
-        }
-        else // one element
-        {
-            node->next    = m_front;
-            m_front->prev = node;
-            m_back = node;
-        }
+        m_ring[index(m_size)] = _data;
         m_size++;
+        return true;
     }
 
-    /// Copies the node data at the front of the queue into the data buffer, then deletes the node
-    /// @return true:  queue copied element to data buffer and deleted node
-    /// @return false: no node was deleted (empty queue) and buffer was left unchanged
+    /// Copies the element at the front of the queue into the data buffer, then removes it
+    /// @return true:  queue copied element to data buffer and removed it
+    /// @return false: nothing was removed (empty queue) and buffer was left unchanged
     inline bool dequeue(T *data_bf = nullptr)
-    {   
+    {
         if (is_empty()) return false;    // empty queue
-        
-        Node *ptr = m_front;            // point to front node
-        if (data_bf != nullptr)
-        {
-            *data_bf = ptr->data;       // copy node data
-        }
 
-        if (m_front != m_back)          // queue contains multiple elements
-        {
-            m_front       = m_front->prev;
-            m_front->next = nullptr;
-        }
-        else                            // only front node in queue
+        if (data_bf != nullptr)
         {
-            m_front = nullptr;
-            m_back  = nullptr;
-
-            m_empty = true;
+            *data_bf = m_ring[m_front]; // copy element
         }
-        delete ptr;
+        m_front = index(1);
         m_size--;
 
         return true;
@@ -43,6 +43,18 @@ class RoundRobin
         return m_sequance.at(pos());
     }
 
+    /// Returns the element next() will return, WITHOUT moving to it
+    inline T peek() const
+    {
+        if (m_length == 0)
+            return T();
+
+        int pos_ = m_pos + (is_running() ? 1 : 0);
+        if (pos_ < 0 || pos_ >= m_length)
+            pos_ = 0;
+        return m_sequance[pos_];
+    }
+
     /// Returns true if the sequance has been depleted to one or zero
     inline bool const is_running() const { return m_length > 1; }
 
@@ -54,6 +66,14 @@ class RoundRobin
         m_length = m_sequance.size();
     }
 
+    /// Removes every element and restarts the rotation (keeps the allocated sequance)
+    inline void clear()
+    {
+        m_sequance.clear();
+        m_pos    = -1;
+        m_length =  0;
+    }
+
     /// Removes element given from the sequance
     /// @param _element element to be removed
     inline void remove(T _element)
@@ -4,11 +4,18 @@ namespace OS
 {
 using UUID = int;
 
-// On each call a unique number is created as a new ID
-inline static UUID create_uuid() 
+/// Creates unique IDs, each game owns an allocator so IDs are never shared between games
+class UUIDAllocator
 {
-    static UUID unique_number;
-    return    ++unique_number;
-}
+ private:
+    UUID m_last = 0;    // last ID created
+
+ public:
+    /// On each call a unique number is created as a new ID
+    inline UUID create() { return ++m_last; }
+
+    /// Restarts the allocator, the next ID created is 1
+    inline void reset()  { m_last = 0; }
+};
 
 } /* ::OS */
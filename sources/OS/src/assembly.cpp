@@ -136,9 +136,9 @@ std::string Inst::to_assembly()
     return code_;
 } /* ::toAsmCode() */
 
-Program::Program(std::string _name, const int _length)
+Program::Program(std::string _name, const int _length, OS::UUID _uuid)
 {
-    m_uuid         = OS::create_uuid();
+    m_uuid         = _uuid;
     m_name         = _name;
     m_length       = _length;
     m_address      = -1;                    // m_address (late init)
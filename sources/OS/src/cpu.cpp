@@ -5,26 +5,277 @@
 /// Operating System handles: fetch/decode/execute cycle, memory, and processes
 namespace OS
 {
-CPU::CPU(Memory *_memory, Scheduler *_sched)
+template<typename Observer>
+BasicCPU<Observer>::BasicCPU(Memory *_memory, Scheduler *_sched)
 {
     os_memory = _memory;
     os_sched  = _sched;
 }
-CPU::CPU() = default;
+template<typename Observer>
+BasicCPU<Observer>::BasicCPU() = default;
 
-Report const CPU::run_fde_cycle()
+/// Returns the field read as A after the modifier swaps
+static inline constexpr InstField field_a(bool _swap) { return _swap ? InstField::B : InstField::A; }
+/// Returns the field read as B after the modifier swaps
+static inline constexpr InstField field_b(bool _swap) { return _swap ? InstField::A : InstField::B; }
+
+template<typename Observer>
+template<Opcode Code, Modifier Mod>
+bool BasicCPU<Observer>::execute_kernel(BasicCPU &_cpu)
+{
+    // pre-decoded at compile time, each branch below is resolved to straight-line code
+    constexpr Decoded   dec_   = Decoder::decode(Code, Mod);
+    constexpr InstField src_a  = field_a(dec_.swap_src),
+                        src_b  = field_b(dec_.swap_src),
+                        dest_a = field_a(dec_.swap_dest),
+                        dest_b = field_b(dec_.swap_dest);
+    constexpr bool      full_t   = dec_.mod == ModifierType::FULL,
+                        double_t = dec_.mod == ModifierType::DOUBLE;
+
+    ControlUnit &ctrl_ = _cpu.ctrl;
+    Cell        &SRC_  = *ctrl_.SRC.cell,
+                &DEST_ = *ctrl_.DEST.cell;
+
+    /* System */
+    if constexpr (Code == Opcode::NOP)
+    {
+        observe(ctrl_.EXE,  Event::NOOP);
+        observe(ctrl_.SRC,  Event::NOOP);
+        observe(ctrl_.DEST, Event::NOOP);
+    }
+    else if constexpr (Code == Opcode::DAT)
+    {
+        observe(ctrl_.EXE,  Event::ILLEGAL);
+        observe(ctrl_.SRC,  Event::NOOP);
+        observe(ctrl_.DEST, Event::NOOP);
+        return true;
+    }
+    else if constexpr (Code == Opcode::MOV)
+    {
+        if constexpr (full_t)
+        {
+            DEST_ = SRC_;
+        }
+        else
+        {
+            if constexpr (double_t)
+                DEST_.set_val(dest_b, SRC_.val(src_b));
+            DEST_.set_val(dest_a, SRC_.val(src_a));
+        }
+        observe(ctrl_.SRC,  Event::READ);
+        observe(ctrl_.DEST, Event::WRITE);
+    }
+    else if constexpr (Code == Opcode::SPL)
+    {
+        _cpu.exe_process.set_status(Status::NEW);
+    }
+    /* Comparision */
+    else if constexpr (dec_.code == OpcodeType::COMPARISION)
+    {
+        observe(ctrl_.SRC,  Event::READ);
+        observe(ctrl_.DEST, Event::READ);
+
+        bool skip_next = true;
+        if constexpr (Code == Opcode::SLT)
+        {
+            if constexpr (double_t)
+                skip_next = SRC_.val(src_b) < DEST_.val(dest_b);
+            skip_next &= SRC_.val(src_a) < DEST_.val(dest_a);
+        }
+        else
+        {
+            bool compare_flag = true;
+            if constexpr (full_t)
+            {
+                compare_flag = SRC_ == DEST_;
+            }
+            else
+            {
+                if constexpr (double_t)
+                    compare_flag = SRC_.val(src_b) == DEST_.val(dest_b);
+                compare_flag &= SRC_.val(src_a) == DEST_.val(dest_a);
+            }
+            skip_next = (Code == Opcode::SEQ) ? compare_flag : !compare_flag;
+        }
+
+        if (skip_next)
+            _cpu.exe_process << ctrl_.EXE.address + 2;
+    }
+    /* Arithmetic */
+    else if constexpr (dec_.code == OpcodeType::ARITHMETIC)
+    {
+        constexpr char operator_char = (Code == Opcode::ADD) ? '+' :
+                                       (Code == Opcode::SUB) ? '-' :
+                                       (Code == Opcode::MUL) ? '*' :
+                                       (Code == Opcode::DIV) ? '/' : '%';
+        if constexpr (Code == Opcode::DIV || Code == Opcode::MOD)
+        {
+            bool zero_div = !(SRC_.val(src_a) && DEST_.val(dest_a));
+            if constexpr (double_t)
+                zero_div |= !(SRC_.val(src_b) && DEST_.val(dest_b));
+
+            if (zero_div) // kill process
+            {
+                observe(ctrl_.EXE,  Event::ILLEGAL);
+                observe(ctrl_.SRC,  Event::NOOP);
+                observe(ctrl_.DEST, Event::NOOP);
+                return true;
+            }
+        }
+        observe(ctrl_.SRC,  Event::READ);
+        observe(ctrl_.DEST, Event::WRITE);
+
+        if constexpr (double_t)
+            DEST_.set_val(dest_b, _cpu.apply_arithmatic(DEST_.val(dest_b), SRC_.val(src_b), operator_char));
+        DEST_.set_val(dest_a, _cpu.apply_arithmatic(DEST_.val(dest_a), SRC_.val(src_a), operator_char));
+    }
+    /* Jump */
+    else
+    {
+        observe(ctrl_.SRC,  Event::READ);
+        observe(ctrl_.DEST, Event::READ);
+
+        bool set_jump = true;
+        if constexpr (Code == Opcode::JMP)
+        {
+            observe(ctrl_.DEST, Event::NOOP);
+        }
+        else if constexpr (Code == Opcode::DJN)
+        {
+            Memory &memory_ = *_cpu.os_memory;
+            bool compare_zero = false;
+            if constexpr (double_t)
+            {
+                DEST_.set_val(dest_b, memory_.normalise(DEST_.val(dest_b) - 1));
+                compare_zero = DEST_.val(dest_b) == 0;
+            }
+            DEST_.set_val(dest_a, memory_.normalise(DEST_.val(dest_a) - 1));
+            compare_zero |= DEST_.val(dest_a) == 0;
+
+            set_jump = !compare_zero;
+        }
+        else // JMZ, JMN
+        {
+            bool compare_zero = true;
+            if constexpr (double_t)
+                compare_zero = DEST_.val(dest_b) == 0;
+            compare_zero &= DEST_.val(dest_a) == 0;
+
+            set_jump = (Code == Opcode::JMZ) ? compare_zero : !compare_zero;
+        }
+
+        if (set_jump)
+            _cpu.exe_process << ctrl_.SRC.address;
+    }
+    return false;
+} /* execute_kernel() */
+
+template<typename Observer>
+template<std::size_t... Op>
+constexpr std::array<typename BasicCPU<Observer>::Kernel, Cell::op_count>
+    BasicCPU<Observer>::build_kernels(std::index_sequence<Op...>)
+{
+    return {{ &BasicCPU::template execute_kernel<Cell::op_code(Op), Cell::op_mod(Op)>... }};
+}
+
+template<typename Observer>
+const std::array<typename BasicCPU<Observer>::Kernel, Cell::op_count> BasicCPU<Observer>::kernel_table =
+    BasicCPU<Observer>::build_kernels(std::make_index_sequence<Cell::op_count>());
+
+template<typename Observer>
+template<std::size_t Inst>
+bool BasicCPU<Observer>::execute_fused(BasicCPU &_cpu, int _pc, int _index, Memory::Compiled const &_cmp)
+{
+    constexpr FusedInst inst_ = Fused::insts[Inst];
+
+    Memory::decode_compiled<inst_.key>(*_cpu.os_memory, &_cpu.ctrl, _pc, _index, _cmp);
+    _cpu.exe_process << _cpu.ctrl.EXE.address +1;   // set program counter
+
+    observe(_cpu.ctrl.EXE, Event::EXECUTE);
+    return execute_kernel<Cell::op_code(inst_.op), Cell::op_mod(inst_.op)>(_cpu);
+} /* execute_fused() */
+
+template<typename Observer>
+template<std::size_t... Inst>
+constexpr std::array<typename BasicCPU<Observer>::FusedHandler, Fused::count>
+    BasicCPU<Observer>::build_fused(std::index_sequence<Inst...>)
+{
+    return {{ &BasicCPU::template execute_fused<Inst>... }};
+}
+
+template<typename Observer>
+const std::array<typename BasicCPU<Observer>::FusedHandler, Fused::count> BasicCPU<Observer>::fused_table =
+    BasicCPU<Observer>::build_fused(std::make_index_sequence<Fused::count>());
+
+template<typename Observer>
+Report const &BasicCPU<Observer>::run_fde_cycle()
+{
+ /* Fetch */
+    int exe_pc;                               // instruction register program counter
+    os_sched->fetch_next(&exe_process);       // fetch next process
+
+    exe_process >> exe_pc;
+    int const exe_index = os_memory->normalise(exe_pc);
+    profile_fetch(exe_index);
+    Memory::Compiled const &exe_cmp = os_memory->compiled(exe_index);    // block cache
+
+ /* Decode + Execute (idiom) */
+    if (exe_cmp.fused && exe_process.status() < Status::HAULTED && !profile_sampled())
+    {
+        m_fused_hits[exe_cmp.fused]++;
+        if (fused_table[exe_cmp.fused](*this, exe_pc, exe_index, exe_cmp))
+            os_sched->kill_process(&exe_process);
+    }
+    else
+    {
+ /* Decode */
+        os_memory->generate_compiled(&ctrl, exe_pc, exe_index, exe_cmp);  // modifier is resolved by the kernel
+        profile_decoded();
+
+ /* Execute */
+        if (exe_process.status() < Status::HAULTED)
+        {
+            exe_process << ctrl.EXE.address +1;   // set program counter
+
+            observe(ctrl.EXE, Event::EXECUTE);
+            if (kernel_table[ctrl.EXE.cell->op()](*this))
+                os_sched->kill_process(&exe_process);
+        }
+        profile_executed();
+    }
+    os_sched->return_process(&exe_process);
+
+    // SPL request new process
+    if(exe_process.status() == Status::NEW)
+    {
+        os_sched->add_process(exe_process.parent(), ctrl.SRC.address);
+    }
+
+    if constexpr (Observer::events)
+        os_memory->encode_registers(&ctrl);
+    os_memory->apply_post_inc(ctrl);
+
+    if constexpr (Observer::events)
+        m_report.record(exe_process, ctrl);
+    else
+        m_report.record_process(exe_process);
+    return m_report;
+} /* run_fde_cycle() */
+
+template<typename Observer>
+Report const &BasicCPU<Observer>::run_reference_cycle()
 {
  /* Fetch */
     int exe_pc;                               // instruction register program counter
-    exe_process = os_sched->fetch_next();     // fetch next process
+    os_sched->fetch_next(&exe_process);       // fetch next process
 
  /* Decode */
     exe_process >> exe_pc;
-    ctrl        = os_memory->generate_ctrl(exe_pc); // generate control unit
+    os_memory->generate_ctrl(&ctrl, exe_pc);        // generate control unit
 
     #ifdef CPU_DEBUG
     printf("\nCore::run_fde_cycle:\t Cycle:[%d]\t Program:[%d] Index:[%d] Inst:'%s' \n",
-        os_sched->cycles(), exe_process.parent_id(),
+        os_sched->cycles(), exe_process.parent(),
         ctrl.EXE.address, (*os_memory)[ctrl.EXE.address].to_assembly().c_str());
     #endif
 
@@ -72,18 +323,20 @@ Report const CPU::run_fde_cycle()
     // SPL request new process
     if(exe_process.status() == Status::NEW)
     {
-        os_sched->add_process(exe_process.parent_id(), ctrl.SRC.address);
+        os_sched->add_process(exe_process.parent(), ctrl.SRC.address);
     }
 
     os_memory->encode_ctrl(&ctrl);
     os_memory->apply_post_inc(ctrl);
 
-    return Report(exe_process, ctrl);
-} /* nextFDEcycle() */
+    m_report.record(exe_process, ctrl);
+    return m_report;
+} /* run_reference_cycle() */
 
-void CPU::execute_system()
+template<typename Observer>
+void BasicCPU<Observer>::execute_system()
 {
-    Opcode       code_  = ctrl.EXE.OP->code;
+    Opcode       code_  = ctrl.EXE.code();
     ModifierType mod_t  = ctrl.TYPE.mod;
     Register     &SRC_  = ctrl.SRC,
                  &DEST_ = ctrl.DEST;
@@ -110,19 +363,17 @@ void CPU::execute_system()
             {
                 case ModifierType::DOUBLE:
                 {
-                    DEST_.B->val = SRC_.B->val;
+                    DEST_.set_b(SRC_.b());
                     /* ->::SINGLE */
                 }
                 case ModifierType::SINGLE:
                 {
-                    DEST_.A->val = SRC_.A->val;
+                    DEST_.set_a(SRC_.a());
                     break;
                 }
                 case ModifierType::FULL:
                 {
-                    *ctrl.DEST.OP = *ctrl.SRC.OP;
-                    *ctrl.DEST.A  = *ctrl.SRC.A;
-                    *ctrl.DEST.B  = *ctrl.SRC.B;
+                    *DEST_.cell = *SRC_.cell;   // whole instruction (single 64-bit copy)
                     break;
                 }
             } /* switch() */
@@ -145,9 +396,10 @@ void CPU::execute_system()
     } /* switch() */
 } /* ::execute_system() */
 
-void CPU::execute_compare()
+template<typename Observer>
+void BasicCPU<Observer>::execute_compare()
 {
-    Opcode       code_  = ctrl.EXE.OP->code;
+    Opcode       code_  = ctrl.EXE.code();
     ModifierType mod_t  = ctrl.TYPE.mod;
     Register     &SRC_  = ctrl.SRC,
                  &DEST_ = ctrl.DEST;
@@ -163,21 +415,16 @@ void CPU::execute_compare()
     {
         if (mod_t == ModifierType::FULL)
         {
-            // entire instruction comparison
-            compare_flag =  SRC_.OP->code == DEST_.OP->code     // [code].<mod>
-                         && SRC_.OP->mod  == DEST_.OP->mod      //
-                         && SRC_.A->admo  == DEST_.A->admo      // <admo>[A],
-                         && SRC_.A->val   == DEST_.A->val       //
-                         && SRC_.B->admo  == DEST_.B->admo      // <admo>[B]
-                         && SRC_.B->val   == DEST_.B->val;      //
+            // entire instruction comparison (single 64-bit compare)
+            compare_flag = *SRC_.cell == *DEST_.cell;
         }
         else
         {
             if (mod_t == ModifierType::DOUBLE)
             {
-                compare_flag  = SRC_.B->val - DEST_.B->val == 0;
+                compare_flag  = SRC_.b() - DEST_.b() == 0;
             }
-            compare_flag &= SRC_.A->val - DEST_.A->val == 0;
+            compare_flag &= SRC_.a() - DEST_.a() == 0;
         }
     }
 
@@ -199,9 +446,9 @@ void CPU::execute_compare()
         {
             if(mod_t == ModifierType::DOUBLE)
             {
-                skip_next = SRC_.B->val < DEST_.B->val;
+                skip_next = SRC_.b() < DEST_.b();
             }
-            skip_next    &= SRC_.A->val < DEST_.A->val;
+            skip_next    &= SRC_.a() < DEST_.a();
             break;
         }
         default:
@@ -219,9 +466,10 @@ void CPU::execute_compare()
     }
 } /* execute_compare() */
 
-void CPU::execute_arithmetic()
+template<typename Observer>
+void BasicCPU<Observer>::execute_arithmetic()
 {
-    Opcode       code_  = ctrl.EXE.OP->code;
+    Opcode       code_  = ctrl.EXE.code();
     ModifierType mod_t  = ctrl.TYPE.mod;
     Register     &SRC_  = ctrl.SRC,
                  &DEST_ = ctrl.DEST;
@@ -250,13 +498,12 @@ void CPU::execute_arithmetic()
     // check for division by zero
     if (code_ == Opcode::DIV || code_ == Opcode::MOD)
     {
-        bool zero_div = false; // true if division by zero
+        bool zero_div = !(SRC_.a() && DEST_.a()); // true if division by zero
 
         if(mod_t == ModifierType::DOUBLE)
         {
-            zero_div = !(SRC_.B->val && DEST_.B->val);
+            zero_div |= !(SRC_.b() && DEST_.b());
         }
-        zero_div = !zero_div && !(SRC_.A->val && DEST_.A->val);
 
         if (zero_div) // kill process
         {
@@ -269,14 +516,15 @@ void CPU::execute_arithmetic()
 
     if(mod_t == ModifierType::DOUBLE)
     {
-        apply_arithmatic(DEST_.B->val, SRC_.B->val, operator_char);
+        DEST_.set_b(apply_arithmatic(DEST_.b(), SRC_.b(), operator_char));
     }
-    apply_arithmatic(DEST_.A->val, SRC_.A->val, operator_char);
+    DEST_.set_a(apply_arithmatic(DEST_.a(), SRC_.a(), operator_char));
 } /* execute_arithmetic() */
 
-void CPU::execute_jump()
+template<typename Observer>
+void BasicCPU<Observer>::execute_jump()
 {
-    Opcode       code_  = ctrl.EXE.OP->code;
+    Opcode       code_  = ctrl.EXE.code();
     ModifierType mod_t  = ctrl.TYPE.mod;
     Register     &SRC_  = ctrl.SRC,
                  &DEST_ = ctrl.DEST;
@@ -290,9 +538,9 @@ void CPU::execute_jump()
     {
         if (mod_t == ModifierType::DOUBLE)
         {
-            compare_zero  = DEST_.B->val == 0;
+            compare_zero  = DEST_.b() == 0;
         }
-        compare_zero &= DEST_.A->val == 0;
+        compare_zero &= DEST_.a() == 0;
     }
 
     bool set_jump = false;
@@ -319,11 +567,11 @@ void CPU::execute_jump()
             compare_zero = false;
             if (mod_t == ModifierType::DOUBLE)
             {
-                DEST_.B->val += -1;
-                compare_zero  = DEST_.B->val == 0;
+                DEST_.set_b(os_memory->normalise(DEST_.b() - 1));
+                compare_zero  = DEST_.b() == 0;
             }
-            DEST_.A->val += -1;
-            compare_zero |= DEST_.A->val == 0;
+            DEST_.set_a(os_memory->normalise(DEST_.a() - 1));
+            compare_zero |= DEST_.a() == 0;
 
             set_jump = !compare_zero;
             break;
@@ -343,4 +591,7 @@ void CPU::execute_jump()
     }
 } /* execute_jump() */
 
+template class BasicCPU<NullObserver>;
+template class BasicCPU<ReportObserver>;
+
 } /* ::OS */
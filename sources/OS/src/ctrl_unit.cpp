@@ -4,12 +4,12 @@
 
 namespace OS
 {
-Register::Register(int _index, Inst *_inst)
+Register::Register(int _index, Cell *_cell)
 {
     address = _index;
-    OP    = &_inst->OP;
-    A     = &_inst->A;
-    B     = &_inst->B;
+    cell  = _cell;
+    A     = InstField::A;
+    B     = InstField::B;
     event = Event::NOOP; // event applied to the address
 }
 Register::Register() = default;
@@ -20,7 +20,8 @@ ControlUnit::ControlUnit(Register _EXE, Register _SRC, Register _DEST)
     SRC    = _SRC;   // EXE [A]
     DEST   = _DEST;  // EXE [B]
 
-    post_A = post_B = nullptr;
+    post_A = { nullptr, InstField::A };
+    post_B = { nullptr, InstField::B };
 
     TYPE.code  = OpcodeType::SYSTEM;
     TYPE.mod   =    ModifierType::SINGLE;
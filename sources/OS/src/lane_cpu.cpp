@@ -0,0 +1,346 @@
+/// Runs independent battles of the same programs in lockstep, one battle in each lane of a shared core
+
+#include <cstdio>
+#include "lane_cpu.hpp"
+
+/// Operating System handles: fetch/decode/execute cycle, memory, and processes
+namespace OS
+{
+template<int Lanes>
+LaneCPU<Lanes>::LaneCPU(int _size)
+{
+    if (!Memory::valid_size(_size))
+    {
+        printf("ERROR: lane memory size |%d| outside [1, %d], using |%d| \n", _size, Memory::max_size(), 8192);
+        _size = 8192;
+    }
+    RAM    = C_RAM<Row>(_size);  // zeroed: (dat #0, #0)
+    m_rows = RAM[0];
+    m_size = _size;
+}
+
+template<int Lanes>
+void LaneCPU<Lanes>::load(int _lane, Image const &_image, ProgramVec *_programs, std::vector<int> const &_addresses,
+                          int _max_cycles, int _max_processes)
+{
+    // reset the lane's addresses to (dat #0, #0), the other lanes are untouched
+    for (int i = 0; i < m_size; i++)
+    {
+        m_rows[i].lane[_lane] = Cell();
+    }
+
+    // place programs at the addresses given, each program is copied from the image
+    for (int i = 0; i < _image.programs(); i++)
+    {
+        Program &program_i = *(*_programs)[i].get();
+        program_i.set_address(RAM.loop_index(_addresses[i]));
+
+        Cell const *cells_ = _image.program(i);
+        for (int j = 0; j < _image.len(i); j++)
+        {
+            RAM[program_i.address() + j]->lane[_lane] = cells_[j];
+        }
+    }
+
+    m_sched[_lane].reset(_programs, _max_cycles, _max_processes);
+    m_pc[_lane] = 0;
+    m_running  |= (LaneMask) 1 << _lane;
+} /* load() */
+
+template<int Lanes>
+template<InstField Field>
+void LaneCPU<Lanes>::decode(LaneMask _lanes, int *adr_, int *post_, uint8_t *post_field_)
+{
+    for (int l = 0; l < Lanes; l++)
+    {
+        bool const on_   = (_lanes >> l) & 1;
+        int  const pc_   = m_pc[l];
+        Cell const exe_  = lane_cell(l, pc_);      // reloaded, the A operand may have pre-decremented it
+        int  const admo_ = (int) exe_.admo(Field);
+
+        // immediate: the executing address, else relative to it
+        int adr_l  = (admo_ == (int) Admo::IMMEDIATE) ? pc_ : wrap(pc_ + exe_.val(Field));
+        int post_l = -1;
+
+        /* Indirect */
+        if (admo_ >= (int) Admo::INDIRECT_A)
+        {
+            // odd modes point through the B field ('@', '<', '>')
+            InstField const ptr_field = (admo_ & 1) ? InstField::B : InstField::A;
+            Cell &ptr_ = lane_cell(l, adr_l);
+
+            if (on_ && (admo_ == (int) Admo::PRE_DEC_A || admo_ == (int) Admo::PRE_DEC_B))
+                ptr_.set_val(ptr_field, wrap(ptr_.val(ptr_field) - 1));
+
+            if (admo_ >= (int) Admo::POST_INC_A)
+                post_l = adr_l;
+            post_field_[l] = (uint8_t) ptr_field;
+
+            adr_l = wrap(adr_l + ptr_.val(ptr_field));
+        }
+        adr_[l]  = adr_l;
+        post_[l] = post_l;
+    }
+} /* decode() */
+
+/// Returns the field read as A after the modifier swaps
+static inline constexpr InstField field_a(bool _swap) { return _swap ? InstField::B : InstField::A; }
+/// Returns the field read as B after the modifier swaps
+static inline constexpr InstField field_b(bool _swap) { return _swap ? InstField::A : InstField::B; }
+
+template<int Lanes>
+template<Opcode Code, Modifier Mod>
+void LaneCPU<Lanes>::execute_kernel(LaneCPU &_cpu, LaneMask _group)
+{
+    // pre-decoded at compile time, each lane runs the same straight-line code
+    constexpr Decoded   dec_   = Decoder::decode(Code, Mod);
+    constexpr InstField src_a  = field_a(dec_.swap_src),
+                        src_b  = field_b(dec_.swap_src),
+                        dest_a = field_a(dec_.swap_dest),
+                        dest_b = field_b(dec_.swap_dest);
+    constexpr bool      full_t   = dec_.mod == ModifierType::FULL,
+                        double_t = dec_.mod == ModifierType::DOUBLE;
+
+    /* System */
+    if constexpr (Code == Opcode::NOP)
+    {
+        return;
+    }
+    else if constexpr (Code == Opcode::DAT)
+    {
+        _cpu.m_kill |= _group;
+        return;
+    }
+    else if constexpr (Code == Opcode::SPL)
+    {
+        _cpu.m_spawn |= _group;
+        return;
+    }
+
+    for (int l = 0; l < Lanes; l++)
+    {
+        if (!((_group >> l) & 1))
+            continue;
+
+        Cell &SRC_  = _cpu.lane_cell(l, _cpu.m_src[l]),
+             &DEST_ = _cpu.lane_cell(l, _cpu.m_dest[l]);
+
+        if constexpr (Code == Opcode::MOV)
+        {
+            if constexpr (full_t)
+            {
+                DEST_ = SRC_;
+            }
+            else
+            {
+                if constexpr (double_t)
+                    DEST_.set_val(dest_b, SRC_.val(src_b));
+                DEST_.set_val(dest_a, SRC_.val(src_a));
+            }
+        }
+        /* Comparision */
+        else if constexpr (dec_.code == OpcodeType::COMPARISION)
+        {
+            bool skip_next = true;
+            if constexpr (Code == Opcode::SLT)
+            {
+                if constexpr (double_t)
+                    skip_next = SRC_.val(src_b) < DEST_.val(dest_b);
+                skip_next &= SRC_.val(src_a) < DEST_.val(dest_a);
+            }
+            else
+            {
+                bool compare_flag = true;
+                if constexpr (full_t)
+                {
+                    compare_flag = SRC_ == DEST_;
+                }
+                else
+                {
+                    if constexpr (double_t)
+                        compare_flag = SRC_.val(src_b) == DEST_.val(dest_b);
+                    compare_flag &= SRC_.val(src_a) == DEST_.val(dest_a);
+                }
+                skip_next = (Code == Opcode::SEQ) ? compare_flag : !compare_flag;
+            }
+            _cpu.m_next[l] += skip_next;
+        }
+        /* Arithmetic */
+        else if constexpr (dec_.code == OpcodeType::ARITHMETIC)
+        {
+            if constexpr (Code == Opcode::DIV || Code == Opcode::MOD)
+            {
+                bool zero_div = !(SRC_.val(src_a) && DEST_.val(dest_a));
+                if constexpr (double_t)
+                    zero_div |= !(SRC_.val(src_b) && DEST_.val(dest_b));
+
+                if (zero_div) // kill process
+                {
+                    _cpu.m_kill |= (LaneMask) 1 << l;
+                    continue;
+                }
+            }
+
+            // operands are normalised: every result is within [-size, 2 * size), except a product
+            auto apply_ = [&_cpu](int l_val, int r_val) -> int {
+                if constexpr (Code == Opcode::ADD) return _cpu.wrap(l_val + r_val);
+                if constexpr (Code == Opcode::SUB) return _cpu.wrap(l_val - r_val);
+                if constexpr (Code == Opcode::MUL) return (int) (((long long) l_val * r_val) % _cpu.m_size);
+                if constexpr (Code == Opcode::DIV) return l_val / r_val;
+                return l_val % r_val;
+            };
+            if constexpr (double_t)
+                DEST_.set_val(dest_b, apply_(DEST_.val(dest_b), SRC_.val(src_b)));
+            DEST_.set_val(dest_a, apply_(DEST_.val(dest_a), SRC_.val(src_a)));
+        }
+        /* Jump */
+        else
+        {
+            bool set_jump = true;
+            if constexpr (Code == Opcode::DJN)
+            {
+                bool compare_zero = false;
+                if constexpr (double_t)
+                {
+                    DEST_.set_val(dest_b, _cpu.wrap(DEST_.val(dest_b) - 1));
+                    compare_zero = DEST_.val(dest_b) == 0;
+                }
+                DEST_.set_val(dest_a, _cpu.wrap(DEST_.val(dest_a) - 1));
+                compare_zero |= DEST_.val(dest_a) == 0;
+
+                set_jump = !compare_zero;
+            }
+            else if constexpr (Code != Opcode::JMP) // JMZ, JMN
+            {
+                bool compare_zero = true;
+                if constexpr (double_t)
+                    compare_zero = DEST_.val(dest_b) == 0;
+                compare_zero &= DEST_.val(dest_a) == 0;
+
+                set_jump = (Code == Opcode::JMZ) ? compare_zero : !compare_zero;
+            }
+
+            // branch-free select of the next program counter
+            _cpu.m_next[l] = set_jump ? _cpu.m_src[l] : _cpu.m_next[l];
+        }
+    }
+} /* execute_kernel() */
+
+template<int Lanes>
+template<std::size_t... Op>
+constexpr std::array<typename LaneCPU<Lanes>::Kernel, Cell::op_count>
+    LaneCPU<Lanes>::build_kernels(std::index_sequence<Op...>)
+{
+    return {{ &LaneCPU::template execute_kernel<Cell::op_code(Op), Cell::op_mod(Op)>... }};
+}
+
+template<int Lanes>
+const std::array<typename LaneCPU<Lanes>::Kernel, Cell::op_count> LaneCPU<Lanes>::kernel_table =
+    LaneCPU<Lanes>::build_kernels(std::make_index_sequence<Cell::op_count>());
+
+template<int Lanes>
+typename LaneCPU<Lanes>::LaneMask LaneCPU<Lanes>::run_cycle()
+{
+    LaneMask const lanes_ = m_running;
+    LaneMask execute_     = 0;   // lanes fetching a live process (not haulted or exited)
+
+ /* Fetch */
+    for (int l = 0; l < Lanes; l++)
+    {
+        if (!((lanes_ >> l) & 1))
+            continue;
+
+        int pc_;
+        m_sched[l].fetch_next(&m_process[l]);
+        m_process[l] >> pc_;
+
+        m_pc[l]   = RAM.loop_index(pc_);
+        m_next[l] = m_pc[l] + 1;
+        execute_ |= (LaneMask) (m_process[l].status() < Status::HAULTED) << l;
+    }
+
+ /* Decode */
+    decode<InstField::A>(lanes_, m_src,  m_post_a, m_post_a_field);
+    decode<InstField::B>(lanes_, m_dest, m_post_b, m_post_b_field);
+
+ /* Execute */
+    // each group is every pending lane executing the same operation as the first pending lane
+    m_kill  = 0;
+    m_spawn = 0;
+    LaneMask pending_ = execute_;
+    while (pending_)
+    {
+        int lead_ = 0;
+        while (!((pending_ >> lead_) & 1))
+            lead_++;
+
+        int const op_ = lane_cell(lead_, m_pc[lead_]).op();
+        LaneMask group_ = 0;
+        for (int l = 0; l < Lanes; l++)
+        {
+            group_ |= (LaneMask) (lane_cell(l, m_pc[l]).op() == op_) << l;
+        }
+        group_ &= pending_;
+
+        kernel_table[op_](*this, group_);
+        pending_ &= ~group_;
+        m_groups++;
+    }
+
+ /* Return */
+    for (int l = 0; l < Lanes; l++)
+    {
+        if (!((lanes_ >> l) & 1))
+            continue;
+
+        LaneMask const lane_ = (LaneMask) 1 << l;
+        PCB &process_ = m_process[l];
+        Scheduler &sched_ = m_sched[l];
+
+        if (execute_ & lane_)
+        {
+            process_ << m_next[l];
+            if (m_spawn & lane_)
+                process_.set_status(Status::NEW);
+            if (m_kill & lane_)
+                sched_.kill_process(&process_);
+        }
+        sched_.return_process(&process_);
+
+        // SPL request new process
+        if (process_.status() == Status::NEW)
+            sched_.add_process(process_.parent(), m_src[l]);
+
+        if (m_post_a[l] >= 0)
+        {
+            Cell &post_ = lane_cell(l, m_post_a[l]);
+            post_.set_val((InstField) m_post_a_field[l], wrap(post_.val((InstField) m_post_a_field[l]) + 1));
+        }
+        if (m_post_b[l] >= 0)
+        {
+            Cell &post_ = lane_cell(l, m_post_b[l]);
+            post_.set_val((InstField) m_post_b_field[l], wrap(post_.val((InstField) m_post_b_field[l]) + 1));
+        }
+
+        m_report[l].record_process(process_);
+        if (process_.status() >= Status::HAULTED)
+            m_running &= ~lane_;
+    }
+    m_cycles++;
+
+    return m_running;
+} /* run_cycle() */
+
+template<int Lanes>
+void LaneCPU<Lanes>::run()
+{
+    while (m_running)
+    {
+        run_cycle();
+    }
+}
+
+template class LaneCPU<8>;
+template class LaneCPU<16>;
+
+} /* ::OS */
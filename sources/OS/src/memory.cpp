@@ -1,85 +1,180 @@
-// memory array assembly simulator containts array of instruction objects and decoding functions
+// memory array assembly simulator containts array of packed instructions and decoding functions
 
+#include <algorithm>
+#include <cstdio>
 #include "memory.hpp"
 
 namespace OS
 {
-Memory::Memory(ProgramVec *_programs, int _min_seperation)
+Memory::Memory(ProgramVec *_programs, int _min_seperation, uint64_t _seed, int _size)
+{
+    resize(_size);
+    reset(_programs, _min_seperation, _seed);
+}
+Memory::Memory() = default;
+
+void Memory::resize(int _size)
+{
+    if (!valid_size(_size))
+    {
+        printf("ERROR: memory size |%d| outside [1, %d], using |%d| \n", _size, max_ram_size, default_size);
+        _size = default_size;
+    }
+    if (!RAM.allocated() || RAM.size() != _size)
+    {
+        RAM      = C_RAM<Cell>(_size);     // zeroed: (dat #0, #0)
+        m_blocks = C_RAM<Compiled>(_size); // zeroed: nothing compiled
+    }
+}
+
+void Memory::clear()
+{
+    if (!RAM.allocated())
+        resize(default_size);
+
+    // populate RAM with (dat #0, #0) asm instructions (a zeroed cell)
+    RAM.clear();
+}
+
+bool Memory::place(ProgramVec *_programs, int _min_seperation, uint64_t _seed)
 {
     ini_min_seperation = _min_seperation;
+    m_rng.seed(_seed);
 
-    // populate RAM with (dat #0, #0) asm instructions
-    RAM = C_RAM<Inst>(ram_size);
+    clear();
 
-    // place programs in core at random positions
-    for (int i = 0; i < _programs->size(); i++)
+    int const n_programs = _programs->size();
+    if (n_programs == 0)
+        return true;
+
+    bool const placeable_ = placeable(n_programs, ini_min_seperation);
+    if (!placeable_)
     {
-        Program program_i = *(*_programs)[i].get();
-        uint32_t rnd_pos  = random_int(ram_size -1);
+        printf("ERROR: memory cannot place |%d| programs |%d| apart in |%d| addresses, spaced evenly \n",
+                n_programs, ini_min_seperation, size());
+    }
 
-        // validate position meets minimum seperation requirements
-        for (int k = 0; k < i; k++)
-        {
-            // get upper & lower limits for seperation boundry
-            int upper   = RAM.loop_index(rnd_pos + ini_min_seperation),
-                lower   = RAM.loop_index(rnd_pos - ini_min_seperation);
+    // every program is followed (clockwise) by a gap of at least 'min_seperation',
+    // the remaining free addresses (slack) are shared out between the gaps at random
+    int const gap_   = placeable_ ? std::max(ini_min_seperation, 0) : size() / n_programs,
+              slack_ = size() - n_programs * gap_;
 
-            int w_index = (*_programs)[k].get()->address();
+    m_slack.resize(n_programs);
+    m_order.resize(n_programs);
 
-            if (w_index > lower && w_index < upper)
-            {
-                // failed; generate new position, restart loop
-                rnd_pos = random_int(ram_size -1);
-                k = 0;
-            }
-        }
-        rnd_pos = RAM.loop_index(rnd_pos);
-        (*_programs)[i].get()->set_address(rnd_pos);
+    // slack before each program, relative to the first (sorted cut points of the slack)
+    m_slack[0] = 0;
+    m_order[0] = 0;
+    for (int i = 1; i < n_programs; i++)
+    {
+        m_slack[i] = m_rng.next(slack_ + 1);
+        m_order[i] = i;
+    }
+    std::sort(m_slack.begin() + 1, m_slack.end());
 
-        // add each program instruction into the core
-        for (int j = 0; j < program_i.len(); j++)
-        {
-            *RAM[rnd_pos] = program_i[j];
-            rnd_pos++;
-        }
+    // shuffle the order of the programs around the core (the first program stays first)
+    for (int i = n_programs - 1; i > 1; i--)
+    {
+        std::swap(m_order[i], m_order[1 + m_rng.next(i)]);
+    }
+
+    int const first_ = m_rng.next(size());
+    for (int i = 0; i < n_programs; i++)
+    {
+        (*_programs)[m_order[i]].get()->set_address(
+            RAM.loop_index(first_ + i * gap_ + m_slack[i])
+        );
+    }
+    return placeable_;
+} /* place() */
 
-        #ifdef MEMORY_DEBUG
-        if (i == 0) printf("\n Memory::Memory: \n");
-        printf("\tAdded |%d| instructions @ address [%d] \t...from: [%d] '%s'\n",
-                program_i.len(), (*_programs)[i].get()->address(),
-                program_i.uuid(), program_i.name().c_str());
-        #endif
+void Memory::place(ProgramVec *_programs, std::vector<int> const &_addresses)
+{
+    // reuse the allocated RAM, reset every address to (dat #0, #0)
+    clear();
+
+    // place programs in core at the addresses given
+    for (int i = 0; i < _programs->size(); i++)
+    {
+        (*_programs)[i].get()->set_address(RAM.loop_index(_addresses[i]));
     }
 }
-Memory::Memory() = default;
 
-uint32_t Memory::random_int(uint32_t max_range)
+void Memory::copy_program(Program const &_program)
 {
-    static uint32_t repeated_flag; // stores first seed, flag triggers on seed repetition
-    static uint32_t seed;          // seed is random and mutates on each function call
+    int adr_ = _program.address();
+    for (int j = 0; j < _program.len(); j++)
+    {
+        *RAM[adr_] = normalise(_program[j]);
+        adr_++;
+    }
 
-    // generate a new seed on the first function call, or when the seed has repeated it's sequance
-    if (seed == repeated_flag)
+    #ifdef MEMORY_DEBUG
+    printf("\tAdded |%d| instructions @ address [%d] \t...from: [%d] '%s'\n",
+            _program.len(), _program.address(), _program.uuid(), _program.name().c_str());
+    #endif
+}
+
+bool Memory::reset(ProgramVec *_programs, int _min_seperation, uint64_t _seed)
+{
+    bool const placed_ = place(_programs, _min_seperation, _seed);
+    for (int i = 0; i < _programs->size(); i++)
+    {
+        copy_program(*(*_programs)[i].get());
+    }
+    return placed_;
+}
+
+bool Memory::reset(Image const &_image, ProgramVec *_programs, int _min_seperation, uint64_t _seed)
+{
+    bool const placed_ = place(_programs, _min_seperation, _seed);
+    for (int i = 0; i < _image.programs(); i++)
     {
-        // large base value ensures a long random sequance before repetition
-        seed  = 0xF2A40816 | repeated_flag;
+        RAM.copy(_image.program(i), _image.len(i), (*_programs)[i].get()->address());
+    }
+    return placed_;
+}
 
-        // clock() is unreliable, which provides a base for randomness
-        seed |= (uint32_t) clock() << seed;
-        repeated_flag = seed;
+void Memory::load(ProgramVec *_programs, std::vector<int> const &_addresses)
+{
+    place(_programs, _addresses);
+    for (int i = 0; i < _programs->size(); i++)
+    {
+        copy_program(*(*_programs)[i].get());
     }
-    // xorshift algorithm
-    seed ^= seed << 13;
-    seed ^= seed >> 17;
-    seed ^= seed << 5;
+}
 
-    return seed % max_range;
+void Memory::load(Image const &_image, ProgramVec *_programs, std::vector<int> const &_addresses)
+{
+    place(_programs, _addresses);
+    for (int i = 0; i < _image.programs(); i++)
+    {
+        RAM.copy(_image.program(i), _image.len(i), (*_programs)[i].get()->address());
+    }
+}
+
+void Memory::create_image(ProgramVec const *_programs, Image *image_) const
+{
+    image_->cells.clear();
+    image_->offsets.clear();
+
+    for (int i = 0; i < _programs->size(); i++)
+    {
+        Program const &program_i = *(*_programs)[i].get();
+
+        image_->offsets.push_back(image_->cells.size());
+        for (int j = 0; j < program_i.len(); j++)
+        {
+            image_->cells.push_back(normalise(program_i[j]));
+        }
+    }
+    image_->offsets.push_back(image_->cells.size());
 }
 
 Register Memory::decode_admo(ControlUnit *_ctrl, InstField const exe_select)
 {
-    Admo _admo = (exe_select == InstField::A) ? _ctrl->EXE.A->admo  // SRC
-                                              : _ctrl->EXE.B->admo; // DEST
+    Admo _admo = (exe_select == InstField::A) ? _ctrl->EXE.admo_a()  // SRC
+                                              : _ctrl->EXE.admo_b(); // DEST
     InstField indirect_select;
     int main_i  = _ctrl->EXE.address;
 
@@ -93,7 +188,7 @@ Register Memory::decode_admo(ControlUnit *_ctrl, InstField const exe_select)
         }
         case Admo::DIRECT:
         {
-            main_i += (*fetch_operand(main_i, exe_select));
+            main_i += fetch_operand(main_i, exe_select).get();
             break;
         }
         /* Indirect */
@@ -118,193 +213,167 @@ Register Memory::decode_admo(ControlUnit *_ctrl, InstField const exe_select)
 
     if (indirect_type)
     {
-        main_i += (*fetch_operand(main_i, exe_select));             // direct
+        main_i += fetch_operand(main_i, exe_select).get();          // direct
 
         if (_admo == Admo::PRE_DEC_A || _admo == Admo::PRE_DEC_B)
         {
-            (*fetch_operand(main_i, indirect_select)) += -1;
+            OperandRef pre_dec = fetch_operand(main_i, indirect_select);
+            pre_dec.set(normalise(pre_dec.get() - 1));
         }
         if (_admo == Admo::POST_INC_A || _admo == Admo::POST_INC_B)
         {
-            int *post_inc = fetch_operand(main_i, indirect_select);
+            OperandRef post_inc = fetch_operand(main_i, indirect_select);
             if(exe_select == InstField::A)
             {
                  _ctrl->post_A = post_inc;
             }
             else _ctrl->post_B = post_inc;
         }
-        main_i += (*fetch_operand(main_i, indirect_select));        // indirect
+        main_i += fetch_operand(main_i, indirect_select).get();     // indirect
     }
     return Register(RAM.loop_index(main_i), RAM[main_i]);
 } /* decode_admo() */
 
 void Memory::decode_modifier(ControlUnit *_ctrl)
 {
-    Opcode _code = _ctrl->EXE.OP->code;
-    Modifier    _mod  = _ctrl->EXE.OP->mod;
+    // pre-decoded from the operation bits (only changed by 'MOV.I' or a load)
+    Decoded const &dec_ = Decoder::lookup(*_ctrl->EXE.cell);
 
-    // allows -> ModifierType::FULL
-    bool full_type = false;
-    // swap flags
-    bool swap_src  = false,
-         swap_dest = false;
-
-    /* [code] Conditionals */
-    switch (_code)
-    {
-        case Opcode::NOP:
-        case Opcode::DAT:
-        case Opcode::JMP:
-        case Opcode::SPL:
-        {
-            /* ignore modifier */
-            return;
-        }
-        case Opcode::MOV:
-        case Opcode::SEQ:
-        case Opcode::SNE:
-        {
-            full_type = true;
-            break;
-        }
-        case Opcode::JMZ: // only change DEST operands on .B
-        case Opcode::JMN:
-        case Opcode::DJN:
-        {
-            if (_mod == Modifier::B)
-            {
-                swap_dest = true;
-                _mod = Modifier::A;
-            }
-            else if (_mod == Modifier::F)
-            {
-                _ctrl->TYPE.mod = ModifierType::DOUBLE;
-                return;
-            }
-            break;
-        }
-        default: break;
-    }
-
-    /* Apply Modifiers */
-    switch (_mod)
-    {
-        /* Single [default] */
-        case Modifier::A:  break;
-        case Modifier::AB:
-        {
-            swap_dest = true;
-            break;
-        }
-        case Modifier::BA:
-        {
-            swap_src = true;
-            break;
-        }
-        case Modifier::B:
-        {
-            swap_src = swap_dest = true;
-            break;
-        }
-        /* Double */
-        case Modifier::F:
-        {
-            _ctrl->TYPE.mod = ModifierType::DOUBLE;
-            break;
-        }
-        case Modifier::X:
-        {
-            swap_dest = true;
-            _ctrl->TYPE.mod = ModifierType::DOUBLE;
-            break;
-        }
-        /* Full */
-        case Modifier::I:
-        {
-            if (full_type)
-            {
-                 _ctrl->TYPE.mod = ModifierType::FULL;
-            }
-            else _ctrl->TYPE.mod = ModifierType::DOUBLE; // else Modifier::F
-            break;
-        }
-        default: break;
-    }
-
-    if (swap_src)                   // SRC A <-> B
+    _ctrl->TYPE.mod = dec_.mod;
+    if (dec_.swap_src)              // SRC A <-> B
     {
         _ctrl->SRC.swap_operands();
     }
-    if (swap_dest)                  // DEST A <-> B
+    if (dec_.swap_dest)             // DEST A <-> B
     {
         _ctrl->DEST.swap_operands();
     }
 } /* decode_modifier() */
 
-ControlUnit Memory::generate_ctrl(int const _pc)
+void Memory::generate_registers(ControlUnit *ctrl_, int const _pc)
 {
-    ControlUnit ctrl_ ( {_pc, RAM[_pc]} );
+    ctrl_->EXE         = Register(_pc, RAM[_pc]);
+    ctrl_->post_A.cell = nullptr;
+    ctrl_->post_B.cell = nullptr;
 
     // decode addressing modes, get SRC (A) and DEST (B) registers
-    ctrl_.SRC  = decode_admo(&ctrl_, InstField::A);
-    ctrl_.DEST = decode_admo(&ctrl_, InstField::B);
-                 decode_modifier(&ctrl_);
+    ctrl_->SRC  = decode_admo(ctrl_, InstField::A);
+    ctrl_->DEST = decode_admo(ctrl_, InstField::B);
+} /* generate_registers() */
+
+void Memory::generate_ctrl(ControlUnit *ctrl_, int const _pc)
+{
+    generate_registers(ctrl_, _pc);
+    decode_modifier(ctrl_);
 
     // determine opcode type
-    switch (ctrl_.EXE.OP->code)
-    {
-        /* System */
-        case Opcode::NOP:
-        case Opcode::DAT:
-        case Opcode::MOV:
-        case Opcode::SPL:
-        {
-            ctrl_.TYPE.code = OpcodeType::SYSTEM;
-            break;
-        }
-        /* Comparision */
-        case Opcode::SEQ:
-        case Opcode::SNE:
-        case Opcode::SLT:
-        {
-            ctrl_.TYPE.code = OpcodeType::COMPARISION;
-            break;
-        }
-        /* Arithmetic */
-        case Opcode::ADD:
-        case Opcode::SUB:
-        case Opcode::MUL:
-        case Opcode::DIV:
-        case Opcode::MOD:
-        {
-            ctrl_.TYPE.code = OpcodeType::ARITHMETIC;
-            break;
-        }
-        /* Jump */
-        case Opcode::JMP:
-        case Opcode::JMZ:
-        case Opcode::JMN:
-        case Opcode::DJN:
-        {
-            ctrl_.TYPE.code = OpcodeType::JUMP;
-            break;
-        }
-        default: break;
-    }
+    ctrl_->TYPE.code = Decoder::lookup(*ctrl_->EXE.cell).code;
 
     #ifdef MEMORY_DEBUG
     printf("\n Memory::generate_ctrl:\t (EXE)  [%d]'%s' \n"
                           "\n\t\t\t (SRC)  [%d]'%s' \n"
                           "\n\t\t\t (DEST) [%d]'%s' \n",
-        ctrl_.EXE.address,  RAM[ctrl_.EXE.address]->to_assembly().c_str(),
-        ctrl_.SRC.address,  RAM[ctrl_.SRC.address]->to_assembly().c_str(),
-        ctrl_.DEST.address, RAM[ctrl_.DEST.address]->to_assembly().c_str());
+        ctrl_->EXE.address,  RAM[ctrl_->EXE.address]->inst().to_assembly().c_str(),
+        ctrl_->SRC.address,  RAM[ctrl_->SRC.address]->inst().to_assembly().c_str(),
+        ctrl_->DEST.address, RAM[ctrl_->DEST.address]->inst().to_assembly().c_str());
     #endif
-
-    return ctrl_;
 } /* generate_ctrl() */
 
-Inst &Memory::operator[](int address) const { return *RAM[address]; }
-Inst &Memory::operator[](int address)       { return *RAM[address]; }
+void Memory::compile_block(int _index)
+{
+    Cell const *cells_  = RAM.data();
+    Compiled   *blocks_ = m_blocks.data();
+
+    int index_ = _index;
+    for (int i = 0; i < max_block_len; i++)
+    {
+        Cell const &cell_ = cells_[index_];
+        Compiled   &cmp_  = blocks_[index_];
+
+        // joins the block compiled from this address
+        if (i > 0 && cmp_.tag == ~cell_.word)
+            break;
+
+        Admo const admo_a = cell_.admo(InstField::A),
+                   admo_b = cell_.admo(InstField::B);
+
+        cmp_.tag   = ~cell_.word;
+        cmp_.a_ptr = (admo_a == Admo::IMMEDIATE) ? index_ : wrap(index_ + cell_.val(InstField::A));
+        cmp_.b_ptr = (admo_b == Admo::IMMEDIATE) ? index_ : wrap(index_ + cell_.val(InstField::B));
+
+        // the A operand pre-decrements the executing cell: the B operand reads it afterwards (decoded each cycle)
+        if ((admo_a == Admo::PRE_DEC_A || admo_a == Admo::PRE_DEC_B) && cmp_.a_ptr == index_)
+            cmp_.b_ptr = -1;
+        cmp_.fused = (cmp_.b_ptr < 0) ? 0 : recognise(index_);
+
+        // the block ends at an instruction which may not continue to the next address
+        Opcode const code_ = cell_.code();
+        OpcodeType const type_ = Decoder::lookup(cell_).code;
+        if (type_ == OpcodeType::JUMP || type_ == OpcodeType::COMPARISION || code_ == Opcode::DAT || code_ == Opcode::SPL)
+            break;
+
+        index_ = (index_ + 1 == size()) ? 0 : index_ + 1;
+    }
+    m_compiled++;
+} /* compile_block() */
+
+uint8_t Memory::recognise(int _index) const
+{
+    Cell const &cell_ = RAM.data()[_index];
+
+    // only the instructions of an idiom are matched against the cells around them
+    int const op_ = cell_.op();
+    if (op_ != Cell::to_op(Opcode::MOV, Modifier::I)  && op_ != Cell::to_op(Opcode::ADD, Modifier::AB) &&
+        op_ != Cell::to_op(Opcode::JMP, Modifier::B)  && op_ != Cell::to_op(Opcode::DJN, Modifier::B))
+        return 0;
+
+    // returns true if the cell at the address holds the operation with one of the addressing modes given
+    auto is_ = [this](int _adr, Opcode _code, Modifier _mod, Admo _a, Admo _a_alt, Admo _b, Admo _b_alt)
+    {
+        Cell const &inst_ = *RAM[_adr];
+        Admo const a_ = inst_.admo(InstField::A),
+                   b_ = inst_.admo(InstField::B);
+        return inst_.op() == Cell::to_op(_code, _mod) && (a_ == _a || a_ == _a_alt) && (b_ == _b || b_ == _b_alt);
+    };
+    // returns the address an operand of the cell at the address points to (its pointer, if indirect)
+    auto target_ = [this](int _adr, InstField _field) { return normalise(_adr + RAM[_adr]->val(_field)); };
+
+    /* Imp: mov.i $0, $1 */
+    if (is_(_index, Opcode::MOV, Modifier::I, Admo::DIRECT, Admo::DIRECT, Admo::DIRECT, Admo::DIRECT) &&
+        cell_.val(InstField::A) == 0 && cell_.val(InstField::B) == 1)
+        return Fused::find(cell_, Idiom::IMP);
+
+    /* Stone: add.ab #step, $ptr | mov.i $bomb, @ptr | jmp $add, the add moves the pointer of the mov */
+    for (int i = 0; i < 3; i++)
+    {
+        int const start_ = _index - i;
+        if (is_(start_,     Opcode::ADD, Modifier::AB, Admo::IMMEDIATE, Admo::IMMEDIATE, Admo::DIRECT,     Admo::DIRECT)     &&
+            is_(start_ + 1, Opcode::MOV, Modifier::I,  Admo::DIRECT,    Admo::DIRECT,    Admo::INDIRECT_B, Admo::INDIRECT_B) &&
+            is_(start_ + 2, Opcode::JMP, Modifier::B,  Admo::DIRECT,    Admo::DIRECT,    Admo::IMMEDIATE,  Admo::IMMEDIATE)  &&
+            target_(start_, InstField::B) == target_(start_ + 1, InstField::B) &&
+            target_(start_ + 2, InstField::A) == normalise(start_))
+            return Fused::find(cell_, Idiom::STONE);
+    }
+
+    /* Paper: mov.i $src (or }src), >dst | djn.b $mov, #count (or $count), the djn loops back to the mov */
+    for (int i = 0; i < 2; i++)
+    {
+        int const start_ = _index - i;
+        if (is_(start_,     Opcode::MOV, Modifier::I, Admo::DIRECT, Admo::POST_INC_A, Admo::POST_INC_B, Admo::POST_INC_B) &&
+            is_(start_ + 1, Opcode::DJN, Modifier::B, Admo::DIRECT, Admo::DIRECT,     Admo::IMMEDIATE,  Admo::DIRECT)     &&
+            target_(start_ + 1, InstField::A) == normalise(start_))
+            return Fused::find(cell_, Idiom::PAPER);
+    }
+    return 0;
+} /* recognise() */
+
+template<std::size_t... Key>
+constexpr std::array<Memory::CompiledDecoder, Cell::admo_count> Memory::build_decoders(std::index_sequence<Key...>)
+{
+    return {{ &Memory::decode_compiled<Key>... }};
+}
+
+const std::array<Memory::CompiledDecoder, Cell::admo_count> Memory::compiled_decoders =
+    Memory::build_decoders(std::make_index_sequence<Cell::admo_count>());
 
 } /* ::OS */
@@ -5,9 +5,9 @@
 /// Operating System handles: fetch/decode/execute cycle, memory simulator, and program processes
 namespace OS {
 
-PCB::PCB(UUID _parent_id, int _pc_initial)
+PCB::PCB(Slot _parent, int _pc_initial)
 {
-    m_parent_id = _parent_id;
+    m_parent    = _parent;
     m_pc        = _pc_initial;
     m_status    = Status::NEW;
 }
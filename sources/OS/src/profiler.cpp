@@ -0,0 +1,157 @@
+/// Instrumentation of the CPU's cycles: instruction counts, instruction mix and sampled latencies
+
+#include <algorithm>
+#include <cstdio>
+#include "profiler.hpp"
+
+namespace OS
+{
+namespace /* {anonymous} */
+{
+/// Returns the assembly of the operation key with the addressing modes only (e.g. 'mov.i $, @')
+std::string key_assembly(int _op, int _admo_key)
+{
+    static char constexpr admo_chars[] = "#$*@{<}>";   // indexed by Admo
+
+    Inst inst_ (
+        { Cell::op_code(_op), Cell::op_mod(_op) },
+        { Cell::key_admo_a(_admo_key), 0 },
+        { Cell::key_admo_b(_admo_key), 0 }
+    );
+    std::string const asm_ = inst_.to_assembly();
+    return asm_.substr(0, asm_.find(' ')) + " "
+         + admo_chars[(int) Cell::key_admo_a(_admo_key)] + ", "
+         + admo_chars[(int) Cell::key_admo_b(_admo_key)];
+}
+
+/// Appends the formatted text to the string
+template<typename... Args>
+void append(std::string &text_, char const *_format, Args... _args)
+{
+    char line_[128];
+    std::snprintf(line_, sizeof(line_), _format, _args...);
+    text_.append(line_);
+}
+} /* ::{anonymous} */
+
+Profiler::Profiler(int _programs)
+{
+    if constexpr (enabled)
+        reset(_programs);
+}
+Profiler::Profiler() : Profiler(0) {}
+
+void Profiler::reset(int _programs)
+{
+    if constexpr (!enabled)
+        return;
+
+    m_counts.assign(Cell::op_count * Cell::admo_count, 0);
+    m_mix.assign(_programs, {});
+    m_decode  = Histogram();
+    m_execute = Histogram();
+    m_cycles  = 0;
+    m_sample  = 1;  // the first cycle is sampled
+
+    int constexpr clock_reads = 64;
+    m_clock = 0;
+    for (int i = 0; i < clock_reads; i++)
+    {
+        long long const start_ = now(),
+                        cost_  = now() - start_;
+        m_clock = (i == 0) ? cost_ : std::min(m_clock, cost_);
+    }
+}
+
+long long Profiler::Histogram::percentile(double _percent) const
+{
+    if (samples == 0)
+        return 0;
+
+    // rank of the sample holding the percentile, the last sample for 100%
+    long long const rank_ = std::min((long long) (_percent / 100.0 * samples), samples - 1);
+
+    long long seen_ = 0;
+    for (int i = 0; i < bucket_count; i++)
+    {
+        seen_ += buckets[i];
+        if (seen_ > rank_)
+            return 1LL << i;
+    }
+    return 0;
+}
+
+std::string Profiler::to_string(int _max_counts) const
+{
+    std::string text_;
+    if constexpr (!enabled)
+        return text_;
+
+    append(text_, "Profile: %lld cycles, clock cost: %lld ns\n", m_cycles, m_clock);
+
+    /* Counts */
+    std::vector<int> keys_;
+    for (int i = 0; i < (int) m_counts.size(); i++)
+    {
+        if (m_counts[i] > 0)
+            keys_.push_back(i);
+    }
+    std::stable_sort(keys_.begin(), keys_.end(), [this](int _lhs, int _rhs)
+    {
+        return m_counts[_lhs] > m_counts[_rhs];
+    });
+    if ((int) keys_.size() > _max_counts)
+        keys_.resize(_max_counts);
+
+    append(text_, "\n\t%-24s %12s %7s\n", "Instruction", "Executed", "Share");
+    for (int key_ : keys_)
+    {
+        append(text_, "\t%-24s %12lld %6.1f%%\n",
+                key_assembly(key_ / Cell::admo_count, key_ % Cell::admo_count).c_str(),
+                m_counts[key_], 100.0 * m_counts[key_] / m_cycles
+        );
+    }
+
+    /* Mix (opcodes executed by any program) */
+    std::vector<int> codes_;
+    for (int code = 0; code < opcode_count; code++)
+    {
+        for (std::array<long long, opcode_count> const &mix_ : m_mix)
+        {
+            if (mix_[code] > 0)
+            {
+                codes_.push_back(code);
+                break;
+            }
+        }
+    }
+
+    append(text_, "\n\t%-8s", "Program");
+    for (int code : codes_)
+    {
+        std::string const asm_ = Inst({ (Opcode) code, Modifier::F }, {}, {}).to_assembly();
+        append(text_, " %9s", asm_.substr(0, asm_.find('.')).c_str());
+    }
+    for (int slot = 0; slot < programs(); slot++)
+    {
+        append(text_, "\n\t%-8d", slot + 1);
+        for (int code : codes_)
+        {
+            append(text_, " %9lld", m_mix[slot][code]);
+        }
+    }
+
+    /* Latency */
+    append(text_, "\n\n\t%-8s %8s %10s %8s %8s %8s\n", "Phase", "Samples", "Mean (ns)", "p50", "p90", "p99");
+    for (auto const &phase_ : { std::make_pair("decode", &m_decode), std::make_pair("execute", &m_execute) })
+    {
+        Histogram const &hist_ = *phase_.second;
+        append(text_, "\t%-8s %8lld %10.1f %8lld %8lld %8lld\n",
+                phase_.first, hist_.samples, hist_.mean(),
+                hist_.percentile(50), hist_.percentile(90), hist_.percentile(99)
+        );
+    }
+    return text_;
+} /* to_string() */
+
+} /* ::OS */
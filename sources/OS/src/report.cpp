@@ -4,16 +4,26 @@
 
 namespace OS
 {
-Report::Report(PCB& _process, ControlUnit& _ctrl)
+Report::Report(PCB const &_process, ControlUnit const &_ctrl)
 {
-    program_id = _process.parent_id();
+    record(_process, _ctrl);
+}
+Report::Report() = default;
+
+void Report::record_process(PCB const &_process)
+{
+    program    = _process.parent();
     _process   >> next_pc;
     status     = _process.status();
+}
+
+void Report::record(PCB const &_process, ControlUnit const &_ctrl)
+{
+    record_process(_process);
 
     exe  = { _ctrl.EXE.address,  _ctrl.EXE.event  };
     src  = { _ctrl.SRC.address,  _ctrl.SRC.event  };
     dest = { _ctrl.DEST.address, _ctrl.DEST.event };
 }
-Report::Report() = default;
 
 } /* ::OS */
@@ -7,46 +7,63 @@ namespace OS {
 
 Scheduler::Scheduler(Asm::ProgramVec *_programs, int _max_cycles, int _max_processes)
 {
+    reset(_programs, _max_cycles, _max_processes);
+}
+Scheduler::Scheduler()  = default;
+
+void Scheduler::reset(Asm::ProgramVec *_programs, int _max_cycles, int _max_processes)
+{
+    int const n_programs = (int) _programs->size();
+
+    // rebuild the queues only when their layout changes
+    if (n_programs != (int) schedules_tbl.size() || _max_processes != ini_max_processes)
+    {
+        schedules_tbl.clear();
+        schedules_tbl.reserve(n_programs);
+        for (Slot i = 0; i < n_programs; i++)
+        {
+            schedules_tbl.emplace_back(_max_processes);
+        }
+    }
+    else for (PrcsQueue &schedule_i : schedules_tbl)
+    {
+        schedule_i.clear();
+    }
+
     ini_max_cycles     = _max_cycles;
     ini_max_processes  = _max_processes;
     m_cycles           = 0;
     m_total_prcs       = 0;
+    m_prcs.assign(n_programs, 0);
+    RR.clear();
 
-    schedules_tbl.reserve(_programs->size());
-
-    // create a queue for each program
-    for (int i = 0; i < _programs->size(); i++)
+    // give each program an initial process, slot [i] is program [i]
+    for (Slot i = 0; i < n_programs; i++)
     {
-        UUID uuid_ = (*_programs)[i].get()->uuid();
-        RR.push_back(uuid_);
-
-        // create a  schedule for the program with an initial process
-        schedules_tbl[uuid_] = PrcsQueue();
-        this->add_process(uuid_, (*_programs)[i].get()->address());
+        RR.push_back(i);
+        this->add_process(i, (*_programs)[i].get()->address());
     }
 
     #ifdef SCHEDULER_DEBUG
-    printf("\nScheduler::Scheduler: initialised with |%d| processes \n", processes());
+    printf("\nScheduler::reset: initialised with |%d| processes \n", processes());
     #endif
-}
-Scheduler::Scheduler()  = default;
+} /* reset() */
 
-void Scheduler::add_process(UUID _parent, int _pc_initial)
+void Scheduler::add_process(Slot _parent, int _pc_initial)
 {
-    PCB process_(_parent, _pc_initial);
-        process_.set_status(Status::NEW);
-
-    if (schedules_tbl.count(_parent))
+    if (has_slot(_parent))
     {
-        if (processes(_parent) < max_processes())
+        // dropped when at max processes (the queue is full)
+        if (schedules_tbl[_parent].enqueue(_pc_initial))
         {
-            schedules_tbl[_parent].enqueue(process_);
+            m_prcs[_parent]++;
+            m_total_prcs++;
         }
     }
-    else printf("ERROR: scheduler failed to add process... UUID|%d| \n", _parent);
+    else printf("ERROR: scheduler failed to add process... Slot|%d| \n", _parent);
 
     #ifdef SCHEDULER_DEBUG_ADD_PCB
-    schedules_tbl[_parent].back() >> _pc_initial;
+    _pc_initial = schedules_tbl[_parent].back();
     printf("\nScheduler::add_process: \t PC:|%d| \t Program:[%d] \n",
             _pc_initial, _parent);
     #endif
@@ -54,53 +71,66 @@ void Scheduler::add_process(UUID _parent, int _pc_initial)
 
 void Scheduler::kill_process(PCB* _process)
 {
-    if (_process == nullptr)
+    if (_process == nullptr || _process->status() == Status::TERMINATED)
         return;
 
-    UUID _uuid = _process->parent_id();
+    Slot _slot = _process->parent();
                  _process->set_status(Status::TERMINATED);
 
     // check parent queue exists
-    if (schedules_tbl.count(_uuid))
+    if (has_slot(_slot))
     {
+        if (m_prcs[_slot] > 0)     // (an empty schedule fetches a process which was never added)
+        {
+            m_prcs[_slot]--;
+            m_total_prcs--;
+        }
+
         // remove parent if depleted
-        if (processes(_uuid) < 1)
+        if (processes(_slot) < 1)
         {
-            RR.remove(_process->parent_id());
+            RR.remove(_slot);
         }
     }
-    else printf("ERROR: scheduler failed to kill process... UUID:[%d] \n", _uuid);
+    else printf("ERROR: scheduler failed to kill process... Slot:[%d] \n", _slot);
 
     #ifdef SCHEDULER_DEBUG_KILL_PCB
     printf("\nScheduler::kill_process:\t Program:[%d] \t PCBs:|%d| \n",
-            _uuid, processes(_process->parent_id()));
+            _slot, processes(_process->parent()));
     #endif
 }
 
 PCB Scheduler::fetch_next()
 {
     PCB process_;
-    schedules_tbl[RR.next()].dequeue(&process_);
+    fetch_next(&process_);
+    return process_;
+}
+
+void Scheduler::fetch_next(PCB *process_)
+{
+    Slot const slot_ = RR.next();
+    int  pc_ = 0;
+    schedules_tbl[slot_].dequeue(&pc_);
 
-    process_.set_status(Status::ACTIVE);
+    *process_ = PCB(slot_, pc_);
+    process_->set_status(Status::ACTIVE);
 
     // hault OS to notify of draw
     if (++m_cycles > max_cycles())
     {
-        process_.set_status(Status::HAULTED);
+        process_->set_status(Status::HAULTED);
     }
     // OS exit, all processes executed
     if (RR.is_running() == false)
     {
-        process_.set_status(Status::EXIT);
+        process_->set_status(Status::EXIT);
     }
 
     #ifdef SCHEDULER_DEBUG
     printf("\nScheduler::fetch_next: \t Program:[%d] \t Processes:|%d| \n",
-           process_.parent_id(), processes(process_.parent_id()) );
+           process_->parent(), processes(process_->parent()) );
     #endif
-
-    return process_;
 }
 
 void Scheduler::return_process(PCB *_process)
@@ -108,14 +138,13 @@ void Scheduler::return_process(PCB *_process)
     if (_process == nullptr || _process->status() == Status::TERMINATED)
         return;
 
-    UUID _uuid = _process->parent_id();
+    Slot _slot = _process->parent();
 
-    if (schedules_tbl.count(_uuid))
+    if (has_slot(_slot))
     {
-        if (processes(_uuid) < max_processes())
-        {
-            schedules_tbl[_uuid].enqueue(*_process);
-        }
+        int pc_;
+        *_process >> pc_;
+        schedules_tbl[_slot].enqueue(pc_);     // dropped when at max processes
     }
 }
 
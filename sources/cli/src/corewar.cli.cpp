@@ -0,0 +1,321 @@
+/// Core CLI: runs a match of core at full speed without the GUI render loop
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include "core.hpp"
+#include "tournament.hpp"
+#include "evaluation.hpp"
+
+namespace /* {anonymous} */
+{
+    using namespace Core;
+    using Clock = std::chrono::steady_clock;
+
+/// Prints how to use the command line interface
+/// @param _exe name of the executable
+void print_usage(char const *_exe)
+{
+    printf( "Usage: %s [options] <warrior> <warrior> ...\n"
+            "\tWarriors are loaded from '%s', match settings from 'core.ini'\n"
+            "Options:\n"
+            "\t-h, --help         show this message\n"
+            "\t-e, --evaluate     play a pair of warriors at every starting offset\n"
+            "\t-t, --tournament   play every warrior against every other warrior\n"
+            "\t                   (all warriors in '%s' if none are given)\n"
+            "\t-m, --melee <n>    warriors per tournament battle (default: 2)\n"
+            "\t-j, --threads <n>  tournament worker threads (default: all cores)\n"
+            "\t-i, --interleave <n>\n"
+            "\t                   tournament battles each worker plays together, one cycle of each in turn\n"
+            "\t                   (default: 1, helps warriors which read across a large core)\n"
+            "\t-s, --seed <n>     placement seed, the same seed replays the same battles (default: random)\n",
+            _exe, Game::warriors_directory(), Game::warriors_directory()
+    );
+}
+
+/// Plays a pair of warriors at every offset and prints the distribution of results
+/// @param _filenames pair of warrior filenames
+/// @param _threads   worker threads
+int run_evaluation(WarriorFiles const &_filenames, int _threads)
+{
+    if (_filenames.size() != 2)
+    {
+        printf("Error: exactly |2| warriors are required\n");
+        return EXIT_FAILURE;
+    }
+    Evaluation evaluation_(_filenames[0], _filenames[1], _threads);
+
+    Clock::time_point const start_ = Clock::now();
+    State const state_ = evaluation_.run();
+    double const seconds_ = std::chrono::duration<double>(Clock::now() - start_).count();
+
+    switch (state_)
+    {
+        case State::ERR_INI:
+        {
+            printf("Error: failed to load 'core.ini'\n");
+            return EXIT_FAILURE;
+        }
+        case State::ERR_WARRIORS:
+        {
+            printf("Error: failed to load warriors from '%s'\n", Game::warriors_directory());
+            return EXIT_FAILURE;
+        }
+        case State::ERR_PLACEMENT:
+        {
+            printf("Error: warriors do not fit 'min separation' apart in the core, see 'core.ini'\n");
+            return EXIT_FAILURE;
+        }
+        default: break;
+    }
+
+    Record const &record_ = evaluation_.record();
+    double const rounds_  = (record_.rounds() > 0) ? record_.rounds() : 1.0;
+
+    printf("\nEvaluation: %s vs %s, offsets [%d, %d]\n",
+            evaluation_.filename(0).c_str(), evaluation_.filename(1).c_str(),
+            evaluation_.first_offset(), evaluation_.last_offset()
+    );
+    printf("\t%-24s %8d (%5.1f%%)\n", "Wins",   record_.wins,   100.0 * record_.wins   / rounds_);
+    printf("\t%-24s %8d (%5.1f%%)\n", "Ties",   record_.ties,   100.0 * record_.ties   / rounds_);
+    printf("\t%-24s %8d (%5.1f%%)\n", "Losses", record_.losses, 100.0 * record_.losses / rounds_);
+    printf("\t%-24s %8d\n", "Score", record_.score());
+
+    printf("\nTime: %.3f s (%.1f battles/s)\n",
+            seconds_, (seconds_ > 0.0) ? evaluation_.offsets() / seconds_ : 0.0
+    );
+    return EXIT_SUCCESS;
+}
+
+/// Plays a tournament and prints the standings
+/// @param _filenames warrior filenames
+/// @param _melee     warriors per battle
+/// @param _threads   worker threads
+/// @param _seed      placement seed
+/// @param _interleave battles each worker plays together
+int run_tournament(WarriorFiles const &_filenames, int _melee, int _threads, uint64_t _seed, int _interleave)
+{
+    Tournament tournament_(_filenames, _melee, _threads, _seed, _interleave);
+    if (tournament_.battles() == 0)
+    {
+        printf("Error: at least |%d| warriors are required\n", std::max(_melee, 2));
+        return EXIT_FAILURE;
+    }
+
+    Clock::time_point const start_ = Clock::now();
+    State const state_ = tournament_.run();
+    double const seconds_ = std::chrono::duration<double>(Clock::now() - start_).count();
+
+    switch (state_)
+    {
+        case State::ERR_INI:
+        {
+            printf("Error: failed to load 'core.ini'\n");
+            return EXIT_FAILURE;
+        }
+        case State::ERR_WARRIORS:
+        {
+            printf("Error: failed to load warriors from '%s'\n", Game::warriors_directory());
+            return EXIT_FAILURE;
+        }
+        case State::ERR_PLACEMENT:
+        {
+            printf("Error: warriors do not fit 'min separation' apart in the core, see 'core.ini'\n");
+            return EXIT_FAILURE;
+        }
+        default: break;
+    }
+
+/** STANDINGS: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    printf("\nTournament: |%d| warriors, |%d| battles, seed: %llu\n",
+            tournament_.warriors(), tournament_.battles(), (unsigned long long) tournament_.seed()
+    );
+    printf("\n\t%-4s %-24s %8s %8s %8s %8s\n", "#", "Warrior", "Score", "Wins", "Ties", "Losses");
+
+    std::vector<int> const standings_ = tournament_.standings();
+    for (int rank = 0; rank < standings_.size(); rank++)
+    {
+        int const warrior_   = standings_[rank];
+        Record const &total_ = tournament_.total(warrior_);
+        printf("\t%-4d %-24s %8d %8d %8d %8d\n",
+                rank + 1, tournament_.filename(warrior_).c_str(),
+                total_.score(), total_.wins, total_.ties, total_.losses
+        );
+    }
+
+/** SCORE MATRIX: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    // score of the row warrior against the column warrior
+    printf("\nScore Matrix:\n\t%-24s", "");
+    for (int j = 0; j < tournament_.warriors(); j++)
+    {
+        printf(" %6d", j + 1);
+    }
+    for (int i = 0; i < tournament_.warriors(); i++)
+    {
+        printf("\n\t%-3d%-21.21s", i + 1, tournament_.filename(i).c_str());
+        for (int j = 0; j < tournament_.warriors(); j++)
+        {
+            if (i == j) printf(" %6s", "-");
+            else        printf(" %6d", tournament_.record(i, j).score());
+        }
+    }
+    printf("\n\nTime: %.3f s (%.1f battles/s)\n",
+            seconds_, (seconds_ > 0.0) ? tournament_.battles() / seconds_ : 0.0
+    );
+    return EXIT_SUCCESS;
+}
+} /* ::{anonymous} */
+
+int main(int argc, char const *argv[])
+{
+/** ARGUMENTS: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    WarriorFiles filenames_;
+    filenames_.reserve(Game::max_players());
+
+    bool tournament_ = false,
+         evaluate_   = false;
+    int  melee_      = 2,
+         threads_    = 0,
+         interleave_ = 1;
+    uint64_t seed_   = Game::random_seed();
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help"))
+        {
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        }
+        else if (!strcmp(argv[i], "-e") || !strcmp(argv[i], "--evaluate"))
+        {
+            evaluate_ = true;
+        }
+        else if (!strcmp(argv[i], "-t") || !strcmp(argv[i], "--tournament"))
+        {
+            tournament_ = true;
+        }
+        else if ((!strcmp(argv[i], "-m") || !strcmp(argv[i], "--melee")) && i + 1 < argc)
+        {
+            melee_ = atoi(argv[++i]);
+        }
+        else if ((!strcmp(argv[i], "-j") || !strcmp(argv[i], "--threads")) && i + 1 < argc)
+        {
+            threads_ = atoi(argv[++i]);
+        }
+        else if ((!strcmp(argv[i], "-i") || !strcmp(argv[i], "--interleave")) && i + 1 < argc)
+        {
+            interleave_ = atoi(argv[++i]);
+        }
+        else if ((!strcmp(argv[i], "-s") || !strcmp(argv[i], "--seed")) && i + 1 < argc)
+        {
+            seed_ = strtoull(argv[++i], nullptr, 0);
+        }
+        else
+        {
+            filenames_.push_back(argv[i]);
+        }
+    }
+
+    if (evaluate_)
+        return run_evaluation(filenames_, threads_);
+
+    if (tournament_)
+    {
+        if (filenames_.empty())
+            filenames_ = Tournament::warriors_directory_files();
+
+        return run_tournament(filenames_, melee_, threads_, seed_, interleave_);
+    }
+
+    if (filenames_.size() < 2 || filenames_.size() > Game::max_players())
+    {
+        printf("Error: between |2| and |%d| warriors are required\n", Game::max_players());
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+/** GAME:SETUP: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    static Game CORE_GAME;
+    CORE_GAME.seed(seed_);
+
+    switch (CORE_GAME.new_game(filenames_))
+    {
+        case State::ERR_INI:
+        {
+            printf("Error: failed to load 'core.ini'\n");
+            return EXIT_FAILURE;
+        }
+        case State::ERR_WARRIORS:
+        {
+            printf("Error: failed to load warriors from '%s'\n", Game::warriors_directory());
+            return EXIT_FAILURE;
+        }
+        case State::ERR_PLACEMENT:
+        {
+            printf("Error: warriors do not fit 'min separation' apart in the core, see 'core.ini'\n");
+            return EXIT_FAILURE;
+        }
+        default: break;
+    }
+
+/** MATCH: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    std::vector<int> round_cycles;              // cycles executed in each round
+    round_cycles.reserve(CORE_GAME.max_rounds());
+    long long total_cycles = 0;
+
+    Clock::time_point const start_ = Clock::now();
+    while (CORE_GAME.state() != State::COMPLETE)
+    {
+        RunSummary const summary_ = CORE_GAME.run_round();
+
+        round_cycles.push_back(summary_.cycles);
+        total_cycles += summary_.cycles;
+
+        if (Game::profiling())
+            printf("\nRound |%d| %s", CORE_GAME.round(), CORE_GAME.profile().to_string().c_str());
+    }
+    double const seconds_ = std::chrono::duration<double>(Clock::now() - start_).count();
+
+/** RESULTS: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    printf("\nMatch: |%d| warriors, |%d| rounds, seed: %llu\n",
+            CORE_GAME.players(), CORE_GAME.max_rounds(), (unsigned long long) CORE_GAME.seed()
+    );
+    for (int plr = 1; plr <= CORE_GAME.players(); plr++)
+    {
+        printf("\t%s\n", CORE_GAME.warrior_string( (Player) plr ).c_str());
+    }
+
+    printf("\nRounds:\n");
+    for (int round = 1; round <= round_cycles.size(); round++)
+    {
+        Player winner_ = CORE_GAME.round_winner(round);
+        printf("\t[%d] %-24s cycles: %d\n",
+                round,
+                (winner_ != Player::NONE) ? CORE_GAME.warrior_string(winner_).c_str() : "Draw",
+                round_cycles[round -1]
+        );
+    }
+
+    printf("\nScores:\n");
+    for (int plr = 1; plr <= CORE_GAME.players(); plr++)
+    {
+        Warrior const &warrior_ = CORE_GAME.warrior( (Player) plr );
+        printf("\t%-24s %d\n", warrior_.to_string().c_str(), warrior_.score());
+    }
+    printf("\nWinner: %s\n", CORE_GAME.warrior_string(CORE_GAME.match_winner()).c_str());
+
+    printf("\nIdioms:\n");
+    for (int i = 1; i < OS::idiom_count; i++)
+    {
+        long long const hits_ = CORE_GAME.idiom_hits((OS::Idiom) i);
+        printf("\t%-24s %lld (%5.1f%%)\n", OS::idiom_name((OS::Idiom) i), hits_,
+                (total_cycles > 0) ? 100.0 * hits_ / total_cycles : 0.0
+        );
+    }
+
+    printf("\nCycles: %lld in %.3f s (%.0f cycles/s)\n",
+            total_cycles, seconds_,
+            (seconds_ > 0.0) ? total_cycles / seconds_ : 0.0
+    );
+    return EXIT_SUCCESS;
+}
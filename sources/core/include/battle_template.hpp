@@ -0,0 +1,45 @@
+/// Warriors and settings loaded once, every battle between the same warriors starts from the template
+#pragma once
+
+#include "core.hpp"
+
+namespace Core
+{
+/// Immutable battle template: the settings (core.ini) and every warrior are loaded and parsed once,
+/// games are created from it without reading or parsing any file (see Game::new_game())
+class BattleTemplate
+{
+ private:
+    WarriorFiles    m_files;    // warrior filenames ("warriors/")
+    Settings        m_settings; // match settings (core.ini)
+    Asm::ProgramVec m_programs; // parsed program of each warrior (never placed)
+    State           m_state;    // READY once loaded, else the error of loading
+
+ public:
+    /// Loads the settings and parses each warrior, check state() for an error (an invalid core size is ERR_INI)
+    /// @param _filenames warrior (program) filenames to load ("warriors/")
+    BattleTemplate(WarriorFiles const &_filenames);
+
+ /* Utility */
+
+    /// Returns READY if the template loaded, else ERR_INI or ERR_WARRIORS (placement is checked per game)
+    inline State const &state() const { return m_state; }
+
+    /// Returns true if the settings and every warrior loaded
+    inline bool loaded() const { return m_state == State::READY; }
+
+    /// Returns the number of warriors
+    inline int warriors() const { return m_programs.size(); }
+
+    /// Returns the match settings
+    inline Settings const &settings() const { return m_settings; }
+
+    /// Returns the parsed program of the warrior
+    inline Asm::Program const &program(int _warrior) const { return *m_programs[_warrior].get(); }
+
+    /// Returns the warrior filename
+    inline std::string const &filename(int _warrior) const { return m_files[_warrior]; }
+
+}; /* BattleTemplate */
+
+} /* ::Core */
@@ -0,0 +1,17 @@
+/// Per-game context containing all mutable state used by a game of core
+#pragma once
+
+#include "settings.hpp"
+#include "random.hpp"
+
+namespace Core
+{
+/// Owns the settings and placement seed of a single game,
+/// games never share a context, so each game can run on its own thread
+struct Context
+{
+    Settings settings;  // match settings (core.ini)
+    uint64_t seed = 0;  // placement seed, each round places programs using its own stream
+};
+
+} /* ::Core */
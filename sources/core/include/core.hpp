@@ -4,7 +4,7 @@
 // #define CORE_DEBUG
 
 #include <list>
-#include "settings.hpp"
+#include "context.hpp"
 #include "parser.hpp"
 #include "memory.hpp"
 #include "scheduler.hpp"
@@ -15,14 +15,14 @@ namespace Core
 {
 using WarriorFiles     = std::vector<std::string>;
 using WarriorFilesList = std::list<std::string>;
-using UUIDTable        = std::unordered_map<OS::UUID, Warrior *>;
-using Warriors         = std::unordered_map<Player,   Warrior>;
+using Warriors         = std::vector<Warrior>;    // warriors, indexed by program slot (player - 1)
 
 /// Used to automate handling, reporting exceptions and game state
 enum class State : int
 {
     ERR_WARRIORS,   // failed to load specified warrior programs
     ERR_INI,        // failed to load configuration file
+    ERR_PLACEMENT,  // warriors can not be placed 'min separation' apart in the core
     WAITING,        // waiting for command (OS is not initialised)
     RESET,          // game has been reset
     READY,          // game paused and ready to run
@@ -31,37 +31,89 @@ enum class State : int
     COMPLETE,       // game complete, requires restart
 };
 
+/// Summary of a batch of cycles run by Game::run_cycles() or Game::run_round()
+struct RunSummary
+{
+    long long cycles    = 0;            // cycles executed in the batch
+    Player    winner    = Player::NONE; // winner of the round (None if running or a draw)
+    int       processes = 0;            // surviving processes after the batch
+    bool      round_end = false;        // true if the round ended within the batch
+};
+
+class BattleTemplate;
+
 class Game
 {
  private:
     static char constexpr warriors_path[] = "warriors/";
     static int  constexpr max_players_cap = 9;  // max players capacity
 
-    /* Hash Tables */
-    UUIDTable uuid_tbl;   // maps OS uuids to warrior references
-    Warriors  m_warriors; // maps players to warriors
+    Context m_ctx;        // settings, UUIDs and random generator of this game
+
+    Warriors  m_warriors; // warrior of each program slot (stable addresses, capacity reserved once)
 
     /* Stats */
     int   m_round;                 // current round number
     State m_state;                 // current game state
     std::vector<Player> m_results; // tracks each rounds results
+    std::vector<uint32_t> m_survivors; // [round]: slots still running at the end of the round (bit per slot)
+    std::array<long long, OS::idiom_count> m_idiom_hits = {};  // [idiom]: cycles run by fused handlers this game
 
     /* Operating System */
     Asm::ProgramVec asm_programs;  // contains all assembly programs
+    OS::Image       os_image;      // packed programs, copied into the core at the start of each round
     OS::Memory      os_memory;     // memory array simulator
     OS::Scheduler   os_sched;      // process scheduler
-    OS::CPU         os_cpu;        // cpu of the operating system
+    OS::CPU         os_cpu;        // cpu of the operating system (full reports, single turns)
+    OS::HeadlessCPU os_batch_cpu;  // cpu without event tracking (batch runs)
     OS::Report      os_report;     // operating system details of the FDE cycle
+    OS::Profiler    os_profiler;   // instruction counts and latencies of the round (CPU_PROFILE builds only)
 
-    /// Restore operating system to default
+    /// Restore operating system to default, programs are placed using the current round's seed
     void restore_os();
 
+    /// Creates the cpus of the round (full reports and headless), both record into the profiler
+    void create_cpus();
+
+    /// Updates the process count of every warrior from the scheduler
+    void update_processes();
+
+    /// Starts the next round if one is pending (the first round uses the placement of new_game)
+    void start_round();
+
+    /// Records the results of the round from the final report, then moves to the next round or completes
+    void end_round();
+
+    /// Runs a single cycle on the headless cpu, updates the process count on a spawn or a death
+    /// @return status of the executing process (HAULTED or EXIT: the round is over)
+    inline OS::Status batch_cycle()
+    {
+        OS::Report const &report_ = os_batch_cpu.run_fde_cycle();
+        OS::Status const status_  = report_.status;
+
+        // process count only changes on a spawn (SPL) or a death (DAT, division by zero)
+        if (status_ == OS::Status::NEW || status_ == OS::Status::TERMINATED)
+            m_warriors[report_.program].update_prcs(os_sched);
+        return status_;
+    }
+
  public:
     Game();
 
     static inline char const *warriors_directory() { return warriors_path;   }
     static inline int  constexpr max_players()     { return max_players_cap; }
 
+    /// Returns a non-deterministic seed (used by default)
+    static uint64_t random_seed();
+
+    /// Sets the seed of the program placements, applies from the next new game or restart.
+    /// Games with the same seed and warriors play out identically
+    /// @param _seed placement seed
+    inline void seed(uint64_t _seed) { m_ctx.seed = _seed; }
+
+    /// Returns the seed of the program placements
+    inline uint64_t const &seed() const { return m_ctx.seed; }
+
  /* Game State */
 
     /// Sets the game state to running, if inititalised
@@ -80,35 +132,73 @@ class Game
     /// @param _filenames warrior (program) filenames to load ("warrior/")
     State new_game(WarriorFiles &_filenames);
 
+    /// Creates a new game using every warrior of the template (wipes previous game state),
+    /// no file is read or parsed, the template must outlive the call only
+    /// @param _template loaded settings and warriors
+    State new_game(BattleTemplate const &_template);
+
+    /// Creates a new game using the warriors selected from the template (wipes previous game state)
+    /// @param _template loaded settings and warriors
+    /// @param _warriors template index of each warrior, in player order
+    State new_game(BattleTemplate const &_template, std::vector<int> const &_warriors);
+
     /// Resets the game, ready to run again using the same warriors
     void restart_game();
 
     /// Runs the next turn in the game, updates the OS report with the new information
     State next_turn();
 
+    /// Runs up to n cycles in a tight loop, stopping early at the end of the round.
+    /// Starts the next round if one is pending, requires a running game (or a new round).
+    /// Bookkeeping is only done on a spawn, a death or the end of the round.
+    /// Runs on the headless cpu: the report after a batch has no events or register logs
+    /// @param _cycles max cycles to execute
+    RunSummary run_cycles(long long _cycles);
+
+    /// Runs the current round to the end (or the next round if one is pending), see run_cycles()
+    RunSummary run_round();
+
+    /// Runs a single cycle of the game (same as run_cycles(1) without a summary), starts the next round
+    /// if one is pending and ends the round after its last cycle. Used to interleave games on one thread
+    /// @return false: the game is complete (or not running), nothing was run
+    bool step();
+
+    /// Hints the cache to load the instruction of the game's next cycle (see Interleaver)
+    inline void prefetch_fetch() const  { os_batch_cpu.prefetch_fetch();  }
+
+    /// Hints the cache to load the operands of the game's next cycle, after prefetch_fetch()
+    inline void prefetch_decode() const { os_batch_cpu.prefetch_decode(); }
+
+    /// Plays a single round to the end with each program at a fixed address instead of a random one,
+    /// reuses the loaded programs and core (requires a new game), the game is complete afterwards.
+    /// Plays the same round as an offset of Evaluation, one core at a time (its reference in tester-evaluation)
+    /// @param _addresses address of each program, in player order
+    /// @return winner of the round, None for a draw
+    Player play_placed_round(std::vector<int> const &_addresses);
+
     /// Return the current round
     inline int const &round() const { return m_round; }
 
     /// Return the max rounds
-    inline int const &max_rounds() const { return Settings::max_rounds(); }
+    inline int const &max_rounds() const { return m_ctx.settings.max_rounds(); }
 
  /* Warrior Utility */
 
     /// [default] Returns the executing warrior
-    inline Warrior const &warrior() const { return *uuid_tbl.at(os_report.program_id); }
+    inline Warrior const &warrior() const { return m_warriors[os_report.program]; }
 
     /// Returns the warrior requested
-    /// @param _uuid warrior's ID
-    inline Warrior const &warrior(OS::UUID _uuid) const { return *uuid_tbl.at(_uuid); }
+    /// @param _slot warrior's program slot
+    inline Warrior const &warrior(OS::Slot _slot) const { return m_warriors.at(_slot); }
 
-    /// Returns the warrior associated with the UUID
+    /// Returns the warrior associated with the player
     /// @param _player warrior's player enum
-    inline Warrior const &warrior(Player _player) const { return m_warriors.at(_player); }
+    inline Warrior const &warrior(Player _player) const { return m_warriors.at(Warrior::slot(_player)); }
 
     /// Returns the full string of the warrior
     inline std::string warrior_string(Player _player) const
     {
-        return (_player != Player::NONE) ? m_warriors.at(_player).to_string()
+        return (_player != Player::NONE) ? warrior(_player).to_string()
                                          : "P0 '/None/'";
     }
 
@@ -121,6 +211,15 @@ class Game
     /// @param _round override which round to return, else defaults to last round
     Player const round_winner(int _round = -1) const;
 
+    /// Returns true if the warrior still had processes at the end of the round: the winner,
+    /// or every warrior still running when a draw was called
+    /// @param _round completed round
+    /// @param _player warrior's player enum
+    inline bool round_survivor(int _round, Player _player) const
+    {
+        return (m_survivors[_round] >> Warrior::slot(_player)) & 1;
+    }
+
     /// Returns the player who won the game overall, or None if the game has no finished
     Player const match_winner() const;
 
@@ -140,6 +239,18 @@ class Game
     /// Returns number of executed cycles
     inline int const &cycles()     const { return os_sched.cycles(); }
 
+    /// Returns the cycles of the completed rounds run by the fused handlers of the idiom (see OS::Idiom)
+    inline long long const &idiom_hits(OS::Idiom _idiom) const { return m_idiom_hits[(int) _idiom]; }
+
+ /* OS::Profiler */
+
+    /// Returns true if the cpus record into the profiler (built with CPU_PROFILE), see profile()
+    static inline bool constexpr profiling() { return OS::Profiler::enabled; }
+
+    /// Returns the instruction counts, instruction mix of each warrior and sampled latencies of the current round,
+    /// or of the last round once it is complete (empty unless profiling(), see OS::Profiler::to_string())
+    inline OS::Profiler const &profile() const { return os_profiler; }
+
     /// Returns max allowed execution cycles (.ini)
     inline int const &max_cycles() const { return os_sched.max_cycles(); }
 
@@ -175,13 +286,13 @@ class Game
     }
 
     /// Returns the size of the OS's RAM
-    static inline int constexpr memory_size()   { return OS::Memory::size();            }
+    inline int const &memory_size() const       { return os_memory.size();              }
 
     /// Returns min seperation between programs in memory (.ini)
-    inline int const &min_separation()    const { return Settings::min_separation();    }
+    inline int const &min_separation()    const { return m_ctx.settings.min_separation();    }
 
     /// Returns max instructions allows in a single programs (.ini)
-    inline int const &max_program_insts() const { return Settings::max_program_insts(); }
+    inline int const &max_program_insts() const { return m_ctx.settings.max_program_insts(); }
 
 }; /* Game */
 
@@ -0,0 +1,59 @@
+/// Evaluates two warriors at every starting offset, instead of random placements
+#pragma once
+
+#include "tournament.hpp"
+#include "lane_cpu.hpp"
+
+namespace Core
+{
+/// Plays one round of a pair of warriors for every legal offset of the second warrior,
+/// the first warrior is always placed at address 0.
+/// Every offset plays the same programs, so each worker plays them in lockstep lanes (see OS::LaneCPU)
+class Evaluation
+{
+ private:
+    using Lanes = OS::LaneCPU<16>;          // offsets played in lockstep by a worker
+
+    static int constexpr batch_size = 64;   // offsets played by a single job (a multiple of the lanes)
+
+    WarriorFiles m_files;           // pair of warrior filenames ("warriors/")
+    int m_threads;                  // worker threads
+
+    /* Results */
+    int m_first_offset;             // offset of the first battle (min separation)
+    std::vector<Player> m_winners;  // [offset - first offset]: winner of the round at each offset
+    Record m_record;                // rounds of the first warrior against the second
+
+ public:
+    /// Creates an evaluation of a pair of warriors
+    /// @param _first  filename of the warrior placed at address 0 ("warriors/")
+    /// @param _second filename of the warrior placed at each offset
+    /// @param _threads worker threads (0: one per hardware thread)
+    Evaluation(std::string const &_first, std::string const &_second, int _threads = 0);
+
+    /// Plays every offset, returns COMPLETE or the error of loading (or placing) the warriors
+    State run();
+
+ /* Utility */
+
+    /// Returns the number of offsets (battles) played
+    inline int offsets() const { return m_winners.size(); }
+
+    /// Returns the first offset played
+    inline int const &first_offset() const { return m_first_offset; }
+
+    /// Returns the last offset played
+    inline int last_offset() const { return m_first_offset + offsets() - 1; }
+
+    /// Returns the winner of the round with the second warrior at the offset, None for a draw
+    inline Player winner(int _offset) const { return m_winners[_offset - m_first_offset]; }
+
+    /// Returns the rounds of the first warrior against the second
+    inline Record const &record() const { return m_record; }
+
+    /// Returns the warrior filename (0: first, 1: second)
+    inline std::string const &filename(int _warrior) const { return m_files[_warrior]; }
+
+}; /* Evaluation */
+
+} /* ::Core */
@@ -0,0 +1,28 @@
+/// Plays independent games on a single thread, one cycle of each game in turn
+#pragma once
+
+#include <vector>
+#include "core.hpp"
+
+namespace Core
+{
+/// Round robins independent games on one thread, a single cycle of each game per turn.
+/// A cycle is a chain of dependent loads (program counter -> instruction -> operand targets), so while one game
+/// executes, the instruction of the game two turns ahead and the operand targets of the next game are prefetched:
+/// each miss is overlapped with the other games' cycles instead of stalling the thread.
+/// Pays off when the cycles are bound by loads (e.g. scanners comparing cells across the core), stores (bombers)
+/// rarely stall the thread and interleaving only adds the cache footprint of the other games. Every game plays as if alone
+class Interleaver
+{
+ private:
+    std::vector<Game *> m_live; // games still in play (reused between calls)
+
+ public:
+    /// Plays every game to completion (each game must be new or running, see Game::new_game()),
+    /// the results are the same as playing each game alone with Game::run_round()
+    /// @param _games games to interleave, a game is dropped from the rotation once complete
+    void play(std::vector<Game *> const &_games);
+
+}; /* Interleaver */
+
+} /* ::Core */
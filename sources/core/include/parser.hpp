@@ -23,7 +23,7 @@ using Modifiers    = std::unordered_map<std::string, Modifier>;
 using AddrModes    = std::unordered_map<char, Admo>;
 
 /// Hashes an opcode string to get the enum value
-Opcodes opcode_tbl =
+Opcodes const opcode_tbl =
 {
     {"nop", Opcode::NOP}, {"dat", Opcode::DAT}, {"mov", Opcode::MOV},
     {"cmp", Opcode::SEQ}, {"seq", Opcode::SEQ}, {"sne", Opcode::SNE}, {"slt", Opcode::SLT},
@@ -32,7 +32,7 @@ Opcodes opcode_tbl =
 };
 
 /// Hashes a modifier string to get the enum value
-Modifiers mod_tbl =
+Modifiers const mod_tbl =
 {
     {"a",  Modifier::A},  {"b",  Modifier::B},
     {"ab", Modifier::AB}, {"ba", Modifier::BA},
@@ -41,7 +41,7 @@ Modifiers mod_tbl =
 };
 
 /// Hashes an addressing mode string to get the enum value
-AddrModes admo_tbl =
+AddrModes const admo_tbl =
 {
     {'#', Admo::IMMEDIATE},  {'$', Admo::DIRECT},
     {'*', Admo::INDIRECT_A}, {'@', Admo::INDIRECT_B},
@@ -121,6 +121,7 @@ Inst assembly_to_inst(std::string &_line, LabelLinker &_linker, int _index);
 /// @param _program_name filename of the program
 /// @param _assembly collection containing the programs assembly code
 /// @param max_program_insts max instructions a program can consist of
-Program *create_program(std::string program_name, AssemblyCode &_assembly, int _max_program_insts);
+/// @param _uuid unique identifier of the program
+Program *create_program(std::string program_name, AssemblyCode &_assembly, int _max_program_insts, OS::UUID _uuid);
 
 } /* ::Parser */
@@ -7,7 +7,7 @@
 
 #include "file_loader.hpp"
 
-/// Singleton class to load & store match settings from a configuration file
+/// Loads & stores match settings from a configuration file, each game owns its own copy
 class Settings
 {
  using ConfigINI = std::unordered_map<std::string, int>;
@@ -15,8 +15,7 @@ class Settings
     static char constexpr ini_section[]  = "[Match Parameters]";
     static char constexpr ini_filename[] = "core.ini";
     static char constexpr ini_comment    = '#';
-    static int  constexpr ini_total_vals = 5;
-    static inline bool    flag_loaded    = false; // true when the '.ini' file has been loaded
+    static int  constexpr ini_total_vals = 6;
 
     /// .ini setting names
     static char constexpr ini_names[ini_total_vals][32] {
@@ -25,6 +24,7 @@ class Settings
         "max_processes",
         "max_program_insts",
         "min_separation",
+        "core_size",
     };
 
     /// default values for the .ini settings, used if parameters are missing
@@ -33,18 +33,25 @@ class Settings
         8,  // max_cycles
         8,  // max_processes
         12, // max_program_insts
-        8   // min_separation
+        8,  // min_separation
+        8192 // core_size
     };
 
     /// stores the .ini contents as a hash table
-    static inline ConfigINI config_ini;
-
-    /// Constructor is blocked
-    Settings(){}
+    ConfigINI config_ini;
 
  public:
+    /// Creates the settings using the default values, until 'load_ini()' is called
+    Settings()
+    {
+        for (int i = 0; i < ini_total_vals; i++)
+        {
+            config_ini[ini_names[i]] = ini_defaults[i];
+        }
+    }
+
     /// Uses File_Loader:: to read match_settings.ini, then processes the contents into the hash table
-    static void load_ini()
+    void load_ini()
     {
         std::vector<std::string> data = File_Loader::load_file_data(ini_filename, ini_comment);
         std::string name; int value; // Map<key, value>
@@ -89,39 +96,26 @@ class Settings
             printf("\t\"%s\" = %d\n", ini_names[i], config_ini.at(ini_names[i]));
             #endif
         }
-        flag_loaded = true;;
     }  /* ::load_ini() */
 
- private:
-    /// Always called before fetching setting to ensure file is loaded
-    static inline void fetch()
-    {
-        // flag to ensure the settings .ini file has been loaded before any values are used
-        if (!flag_loaded)
-            load_ini();
-    }
-
- public:
-    /// Copy creation method deleted
-    Settings(Settings const &)        = delete;
-    /// Assignment operator method deleted
-    void operator= (Settings const &) = delete;
-
  /* Parameters */
 
     /// Max number of rounds before the game is concluded
-    static inline int const &max_rounds()        { fetch(); return config_ini.at(ini_names[0]); }
+    inline int const &max_rounds()        const { return config_ini.at(ini_names[0]); }
 
     /// Max number of cycles before the round has been concluded
-    static inline int const &max_cycles()        { fetch(); return config_ini.at(ini_names[1]); }
+    inline int const &max_cycles()        const { return config_ini.at(ini_names[1]); }
 
     /// Max number of processes a single program can create
-    static inline int const &max_processes()     { fetch(); return config_ini.at(ini_names[2]); }
+    inline int const &max_processes()     const { return config_ini.at(ini_names[2]); }
 
     /// Max instructions a program can consist of
-    static inline int const &max_program_insts() { fetch(); return config_ini.at(ini_names[3]); }
+    inline int const &max_program_insts() const { return config_ini.at(ini_names[3]); }
 
     /// Min distance between programs at the start of a round
-    static inline int const &min_separation()    { fetch(); return config_ini.at(ini_names[4]); }
+    inline int const &min_separation()    const { return config_ini.at(ini_names[4]); }
+
+    /// Number of memory addresses within the core
+    inline int const &core_size()         const { return config_ini.at(ini_names[5]); }
 
 }; /* ::Settings */
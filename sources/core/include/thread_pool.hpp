@@ -0,0 +1,114 @@
+/// Work stealing thread pool used to run independent jobs in parallel
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Core
+{
+/// Runs a batch of jobs across worker threads, each worker owns a range of jobs
+/// and steals half of another worker's range once its own range is depleted
+class ThreadPool
+{
+ private:
+    /// Range of job indexes [begin, end) owned by a worker
+    struct Range
+    {
+        std::mutex lock;    // guards the range, held only while taking jobs
+        int begin = 0,      // next job to run
+            end   = 0;      // one past the last job
+    };
+
+    int m_threads;          // number of worker threads
+
+ public:
+    /// Creates a thread pool
+    /// @param _threads number of worker threads (0: one per hardware thread)
+    ThreadPool(int _threads = 0)
+    {
+        m_threads = (_threads > 0) ? _threads : (int) std::thread::hardware_concurrency();
+        m_threads = std::max(m_threads, 1);
+    }
+
+    /// Returns the number of worker threads
+    inline int const &threads() const { return m_threads; }
+
+    /// Runs every job, returns once all jobs are complete
+    /// @param _jobs total number of jobs, each job is identified by its index [0, _jobs)
+    /// @param _func called as _func(job, worker), where worker is the index of the running thread
+    template<typename Func>
+    void run(int const _jobs, Func &&_func)
+    {
+        int const workers_ = std::min(m_threads, std::max(_jobs, 1));
+        std::unique_ptr<Range[]> ranges_(new Range[workers_]);
+
+        // split jobs evenly between workers
+        for (int i = 0; i < workers_; i++)
+        {
+            ranges_[i].begin = (int) ((long long) _jobs *  i      / workers_);
+            ranges_[i].end   = (int) ((long long) _jobs * (i + 1) / workers_);
+        }
+
+        auto work_ = [&](int const _worker)
+        {
+            Range &own_ = ranges_[_worker];
+            int job_;
+            while (true)
+            {
+                /* Own Range */
+                {
+                    std::lock_guard<std::mutex> guard_(own_.lock);
+                    job_ = (own_.begin < own_.end) ? own_.begin++ : -1;
+                }
+                if (job_ >= 0)
+                {
+                    _func(job_, _worker);
+                    continue;
+                }
+
+                /* Steal */
+                bool stolen_ = false;
+                for (int i = 1; i < workers_ && !stolen_; i++)
+                {
+                    Range &victim_ = ranges_[(_worker + i) % workers_];
+                    int begin_, end_;
+                    {
+                        std::lock_guard<std::mutex> guard_(victim_.lock);
+                        int const left_ = victim_.end - victim_.begin;
+                        if (left_ < 1)
+                            continue;
+
+                        // take the back half (rounded up) of the victim's jobs
+                        end_   = victim_.end;
+                        begin_ = victim_.end - (left_ + 1) / 2;
+                        victim_.end = begin_;
+                    }
+                    std::lock_guard<std::mutex> guard_(own_.lock);
+                    own_.begin = begin_;
+                    own_.end   = end_;
+                    stolen_    = true;
+                }
+                if (!stolen_)
+                    return; // no jobs left to steal
+            }
+        };
+
+        std::vector<std::thread> pool_;
+        pool_.reserve(workers_ - 1);
+        for (int i = 1; i < workers_; i++)
+        {
+            pool_.emplace_back(work_, i);
+        }
+        work_(0); // calling thread is worker 0
+
+        for (std::thread &thread_ : pool_)
+        {
+            thread_.join();
+        }
+    }
+}; /* ThreadPool */
+
+} /* ::Core */
@@ -0,0 +1,115 @@
+/// Runs every warrior against every other warrior across a thread pool
+#pragma once
+
+#include "core.hpp"
+
+namespace Core
+{
+using Battle = std::vector<int>;  // indexes of the warriors taking part in a battle
+
+/// Rounds won, tied and lost by a warrior
+struct Record
+{
+    int wins   = 0,
+        ties   = 0,
+        losses = 0;
+
+    /// Returns the number of rounds played
+    inline int rounds() const { return wins + ties + losses; }
+
+    /// Returns the points scored, wins are worth double (same as a game)
+    inline Score score() const { return wins * 2 + ties; }
+
+    inline Record &operator+=(Record const &_rhs)
+    {
+        wins   += _rhs.wins;
+        ties   += _rhs.ties;
+        losses += _rhs.losses;
+        return *this;
+    }
+};
+
+class Tournament
+{
+ private:
+    static int constexpr max_interleave = 16;   // battles a worker can play together
+
+    WarriorFiles        m_files;    // warrior filenames ("warriors/")
+    std::vector<Battle> m_battles;  // every pairing (or melee) to play
+    int m_melee;                    // warriors per battle
+    int m_threads;                  // worker threads
+    int m_interleave;               // battles played together by a worker (see Interleaver)
+    uint64_t m_seed;                // each battle is seeded with its own stream of this seed
+
+    /// Score matrix and totals, each worker records into its own results
+    struct Results
+    {
+        std::vector<Record> matrix;   // [i * warriors + j]: rounds of warrior i against warrior j
+        std::vector<Record> totals;   // [i]: rounds of warrior i against everyone
+
+        /// Clears the results for the number of warriors
+        void clear(int _warriors);
+
+        Results &operator+=(Results const &_rhs);
+    };
+    Results m_results;
+
+    /// Adds every combination of _melee warriors to the battles
+    void create_battles();
+
+    /// Adds the results of a completed game to the records
+    /// @param _game   game played until complete
+    /// @param _battle warriors taking part, in player order
+    /// @param _results results to record into
+    void record_game(Game const &_game, Battle const &_battle, Results &_results) const;
+
+ public:
+    /// Creates a tournament, every warrior meets every other warrior for a full game
+    /// @param _filenames warrior (program) filenames to load ("warriors/")
+    /// @param _melee     warriors per battle, 2 for pairings up to Game::max_players() for melees
+    /// @param _threads   worker threads (0: one per hardware thread)
+    /// @param _seed      placement seed, the same seed reproduces every battle regardless of thread
+    /// @param _interleave battles each worker plays together, one cycle of each in turn (1: one battle at a time)
+    Tournament(WarriorFiles const &_filenames, int _melee = 2, int _threads = 0, uint64_t _seed = 0, int _interleave = 1);
+
+    /// Returns the filenames of every warrior in the warriors directory (sorted)
+    static WarriorFiles warriors_directory_files();
+
+    /// Plays every battle, returns COMPLETE or the error of loading the settings or warriors (or placing them)
+    State run();
+
+ /* Utility */
+
+    /// Returns the number of warriors
+    inline int warriors() const { return m_files.size(); }
+
+    /// Returns the number of battles (full games) played by the tournament
+    inline int battles()  const { return m_battles.size(); }
+
+    /// Returns the placement seed
+    inline uint64_t const &seed() const { return m_seed; }
+
+    /// Returns the number of battles each worker plays together
+    inline int const &interleave() const { return m_interleave; }
+
+    /// Returns the placement seed of a battle
+    inline uint64_t battle_seed(int _battle) const { return OS::Random::stream(m_seed, _battle); }
+
+    /// Returns the warriors taking part in a battle
+    inline Battle const &battle(int _battle) const { return m_battles[_battle]; }
+
+    /// Returns the warrior filename
+    inline std::string const &filename(int _warrior) const { return m_files[_warrior]; }
+
+    /// Returns the rounds of warrior i against warrior j
+    inline Record const &record(int _i, int _j) const { return m_results.matrix[_i * warriors() + _j]; }
+
+    /// Returns the rounds of the warrior against every other warrior
+    inline Record const &total(int _warrior) const { return m_results.totals[_warrior]; }
+
+    /// Returns warrior indexes ordered by total score (highest first)
+    std::vector<int> standings() const;
+
+}; /* Tournament */
+
+} /* ::Core */
@@ -61,6 +61,12 @@ class Warrior
     /// Returns enum of the warrior's play
     inline Player const &player()    const { return m_player;    }
 
+    /// Returns the program slot of the warrior (scheduler index)
+    inline OS::Slot slot()           const { return slot(m_player); }
+
+    /// Returns the program slot of a player (P1 is slot 0)
+    static inline OS::Slot slot(Player _player) { return (int) _player - 1; }
+
     /// Returns current number of processes
     inline int const &prcs()         const { return m_prcs;      }
 
@@ -81,8 +87,8 @@ class Warrior
         return std::string( player_string() + " '" + name() + "'" );
     }
 
-    /// Updates the processes using the Game's scheduler
-    inline void update_prcs(OS::Scheduler &_sched) { m_prcs = _sched.processes(*m_id); }
+    /// Updates the processes using the Game's scheduler (live counter, constant time)
+    inline void update_prcs(OS::Scheduler &_sched) { m_prcs = _sched.processes(slot()); }
 
     /// Updates game stats based on the final report
     inline void update_game_results(OS::Report &_report)
@@ -0,0 +1,50 @@
+/// Loads the warriors and settings of a battle once
+
+#include "battle_template.hpp"
+
+namespace Core
+{
+
+BattleTemplate::BattleTemplate(WarriorFiles const &_filenames)
+{
+    m_files = _filenames;
+    m_state = State::READY;
+
+    /* Load Settings */
+    try
+    {
+        m_settings.load_ini();
+    }
+    catch (const std::exception e) { m_state = State::ERR_INI; return; }
+
+    if (!OS::Memory::valid_size(m_settings.core_size()))
+    {
+        printf("Error: expected 'core_size' within [1, %d] but found |%d| in config file\n",
+                OS::Memory::max_size(), m_settings.core_size()
+        );
+        m_state = State::ERR_INI;
+        return;
+    }
+
+    /* Load Warriors */
+    OS::UUIDAllocator uuids_;
+    m_programs.reserve(m_files.size());
+    for (std::string const &filename : m_files)
+    {
+        // load + parse warrior files
+        try
+        {
+            Parser::AssemblyCode asm_code(
+                File_Loader::load_file_data(Game::warriors_directory() + filename, ASSEMBLY_COMMENT)
+            );
+
+            m_programs.push_back(
+                Asm::UniqProgram(
+                    Parser::create_program(filename, asm_code, m_settings.max_program_insts(), uuids_.create())
+                )
+            );
+        } catch (const std::exception e) { m_state = State::ERR_WARRIORS; return; }
+    }
+}
+
+} /* ::Core */
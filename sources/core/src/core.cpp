@@ -1,31 +1,66 @@
 ﻿/// Runs the game of core
 
+#include <limits>
+#include <random>
+#include <algorithm>
 #include "core.hpp"
+#include "battle_template.hpp"
 
 namespace Core
 {
 
-Game::Game() { m_state = State::WAITING; }
+Game::Game()
+{
+    m_state = State::WAITING;
+    m_ctx.seed = random_seed();
+    os_memory.resize(m_ctx.settings.core_size());   // default size until a game is loaded
+}
+
+uint64_t Game::random_seed()
+{
+    std::random_device device_;
+    return ((uint64_t) device_() << 32) | device_();
+}
 
 void Game::restore_os()
 {
-    os_memory = OS::Memory(     /* Always before scheduler (needs program counter addresses) */
+    // reuses the core and the process queues of the previous round
+    os_memory.reset(     /* Always before scheduler (needs program counter addresses) */
+        os_image,
         &asm_programs,
-        Settings::min_separation()
+        m_ctx.settings.min_separation(),
+        OS::Random::stream(m_ctx.seed, m_round)
     );
-    os_sched  = OS::Scheduler(
+    os_sched.reset(
         &asm_programs,
-        Settings::max_cycles(),
-        Settings::max_processes()
+        m_ctx.settings.max_cycles(),
+        m_ctx.settings.max_processes()
     );
-    os_cpu    = OS::CPU(&os_memory, &os_sched);
+    create_cpus();
+    update_processes();
 
     // leave report untouched, used after game complete, overridden on next turn
 }
 
+void Game::create_cpus()
+{
+    os_cpu       = OS::CPU(&os_memory, &os_sched);
+    os_batch_cpu = OS::HeadlessCPU(&os_memory, &os_sched);
+    os_cpu.profile(&os_profiler);
+    os_batch_cpu.profile(&os_profiler);
+}
+
+void Game::update_processes()
+{
+    for (Warrior &warrior_ : m_warriors)
+    {
+        warrior_.update_prcs(os_sched);
+    }
+}
+
 void Game::play_game()
 {
-    if (m_state != State::WAITING && uuid_tbl.size() > 0 && m_state != State::COMPLETE)
+    if (m_state != State::WAITING && m_warriors.size() > 0 && m_state != State::COMPLETE)
         m_state = State::RUNNING;
 }
 
@@ -52,10 +87,15 @@ void Game::restart_game()
     m_results.clear();
     m_results.resize( m_round + max_rounds() );
     m_results[m_round] = Player::NONE;            // round 0 is none
+    m_survivors.assign( m_results.size(), 0 );
+    m_idiom_hits.fill(0);
+    #ifdef CPU_PROFILE
+    os_profiler.reset(players());
+    #endif
 
-    for (auto &itr : m_warriors)
+    for (Warrior &warrior_ : m_warriors)
     {
-        itr.second.clear_stats();
+        warrior_.clear_stats();
     }
     restore_os();
     m_state = State::RESET;
@@ -65,80 +105,98 @@ State Game::new_game(WarriorFiles &_filenames)
 {
     int total_warriors = (_filenames.size() > max_players_cap) ? max_players_cap
                                                                : _filenames.size();
-    restart_game();
+    // settings and warriors are loaded + parsed by the template
+    BattleTemplate const template_(
+        WarriorFiles(_filenames.begin(), _filenames.begin() + total_warriors)
+    );
+    return new_game(template_);
+}
 
-    uuid_tbl.clear();
-    uuid_tbl.reserve(max_players_cap);
+State Game::new_game(BattleTemplate const &_template)
+{
+    std::vector<int> warriors_(std::min(_template.warriors(), (int) max_players_cap));
+    for (int i = 0; i < warriors_.size(); i++)
+    {
+        warriors_[i] = i;
+    }
+    return new_game(_template, warriors_);
+}
 
-    m_warriors.clear();
-    m_warriors.reserve(max_players_cap);
+State Game::new_game(BattleTemplate const &_template, std::vector<int> const &_warriors)
+{
+    if (!_template.loaded())
+        return _template.state();
 
-    asm_programs.clear();
-    asm_programs.reserve(max_players_cap);
+    int total_warriors = (_warriors.size() > max_players_cap) ? max_players_cap
+                                                              : _warriors.size();
+    Settings const &settings_ = _template.settings();
+    if (!OS::Memory::placeable(total_warriors, settings_.min_separation(), settings_.core_size()))
+        return State::ERR_PLACEMENT;
 
-    /* Load Settings */
-    try
-    {
-        Settings::load_ini();
-    }
-    catch (const std::exception e) { return State::ERR_INI; }
+    m_ctx.settings = settings_;
+    os_memory.resize(m_ctx.settings.core_size());   // reallocated only if the size changed
 
     #ifdef CORE_DEBUG
     printf("\n Core::Game::init: loaded settings: 'config.ini' \n");
     #endif
 
-    /* Load Warriors */
+    m_warriors.clear();
+    m_warriors.reserve(max_players_cap);
+
+    asm_programs.clear();
+    asm_programs.reserve(max_players_cap);
+
+    /* Copy Warriors */
     for (int i = 0; i < total_warriors; i++)
     {
-        // load + parse warrior files
-        std::string filename = _filenames[i];
-        try
-        {
-            Parser::AssemblyCode asm_code(
-                File_Loader::load_file_data(warriors_path + filename, ASSEMBLY_COMMENT)
-            );
-
-            asm_programs.push_back(
-                Asm::UniqProgram(
-                    Parser::create_program(filename, asm_code, max_program_insts())
-                )
-            );
-        } catch (const std::exception e) { return State::ERR_WARRIORS; }
+        // copy of the parsed program (placed by each game)
+        asm_programs.push_back(
+            Asm::UniqProgram( new Asm::Program(_template.program(_warriors[i])) )
+        );
 
         Player   const player_ = (Player) (i + 1);
         OS::UUID const &warrior_id = asm_programs[i].get()->uuid();
 
-        /* Create Warrior */
-        m_warriors[player_] =
+        /* Create Warrior (slot [i]) */
+        m_warriors.push_back(
             Warrior(
                 warrior_id,
                 asm_programs[i].get()->name(),
                 player_
-            );
-
-        /* Set UUID table to Warrior */
-        uuid_tbl[warrior_id] = &m_warriors[player_];
+            )
+        );
 
         #ifdef CORE_DEBUG
         if (i == 0) printf("\n Core::Game::init: loaded warriors: \n");
-        printf("\t [%d] '%s%s' \n", i, warriors_path, filename.c_str());
+        printf("\t [%d] '%s%s' \n", i, warriors_path, _template.filename(_warriors[i]).c_str());
         #endif
     }
-    restore_os();
+    os_memory.create_image(&asm_programs, &os_image);
+
+    restart_game();
     m_round = 0;
 
     return m_state = State::NEW_ROUND;
 } /* init() */
 
-State Game::next_turn()
+void Game::start_round()
 {
     if (m_state == State::NEW_ROUND)
     {
-        if (m_round > 0)    // skip for new game
-            restore_os();
         m_round++;
+        if (m_round > 1)    // skip for new game
+            restore_os();
+
+        #ifdef CPU_PROFILE
+        os_profiler.reset(players());   // each round is profiled on its own
+        #endif
         m_state = State::READY;
     }
+}
+
+State Game::next_turn()
+{
+    start_round();
 
     if (m_state != State::RUNNING)
         return m_state;
@@ -147,49 +205,163 @@ State Game::next_turn()
     os_report          = os_cpu.run_fde_cycle();
     OS::Status status_ = os_report.status;
 
-    Warrior *warrior_ = uuid_tbl[os_report.program_id];
-    warrior_->update_prcs(os_sched);
+    Warrior *warrior_ = &m_warriors[os_report.program];
+
+    // process count only changes on a spawn (SPL) or a death (DAT, division by zero)
+    if (status_ == OS::Status::NEW || status_ == OS::Status::TERMINATED)
+        warrior_->update_prcs(os_sched);
 
     /* Round End */
     if (status_ >= OS::Status::HAULTED)
+        end_round();
+
+    return m_state;
+} /* next_turn() */
+
+void Game::end_round()
+{
+    OS::Status const status_  = os_report.status;
+    Warrior          *warrior_ = &m_warriors[os_report.program];
+
+    /* Warrior Win/Draw */
+    if (status_ == OS::Status::EXIT)
     {
-        /* Warrior Win/Draw */
-        if (status_ == OS::Status::EXIT)
-        {
-            m_results[m_round] = warrior_->player();
-            warrior_->update_game_results(os_report);
-        }
-        else if (status_ == OS::Status::HAULTED)
+        m_results[m_round]   = warrior_->player();
+        m_survivors[m_round] = 1u << os_report.program;
+        warrior_->update_game_results(os_report);
+    }
+    else if (status_ == OS::Status::HAULTED)
+    {
+        m_results[m_round]   = Player::NONE;
+        m_survivors[m_round] = 0;
+        for (int i = 0; i < players(); i++)
         {
-            m_results[m_round] = Player::NONE;
-            for (int i = 1; i >= m_warriors.size(); i++)
+            Warrior &warrior_i = m_warriors[i];
+            if (warrior_i.is_alive())
             {
-                if (m_warriors[ (Player) i ].is_alive())
-                    m_warriors[ (Player) i ].update_game_results(os_report);
+                warrior_i.update_game_results(os_report);
+                m_survivors[m_round] |= 1u << i;
             }
         }
+    }
 
-        /* Game Complete  */
-        if (m_round == max_rounds())
-        {
-            m_state = State::COMPLETE;
+    // both cpus are recreated each round (see restore_os())
+    for (int i = 1; i < OS::idiom_count; i++)
+    {
+        m_idiom_hits[i] += os_cpu.idiom_hits((OS::Idiom) i) + os_batch_cpu.idiom_hits((OS::Idiom) i);
+    }
 
-            #ifdef CORE_DEBUG
-            printf("\n Core::Game::next_turn:\t GAME OVER \n");
-            #endif
-        }
-        /* New Round */
-        else
-        {
-            m_state = State::NEW_ROUND;
+    /* Game Complete  */
+    if (m_round == max_rounds())
+    {
+        m_state = State::COMPLETE;
 
-            #ifdef CORE_DEBUG
-            printf("\n Core::Game::next:\t Round |%d| complete \n", m_round);
-            #endif
-        }
+        #ifdef CORE_DEBUG
+        printf("\n Core::Game::end_round:\t GAME OVER \n");
+        #endif
     }
-    return m_state;
-} /* next_turn() */
+    /* New Round */
+    else
+    {
+        m_state = State::NEW_ROUND;
+
+        #ifdef CORE_DEBUG
+        printf("\n Core::Game::end_round:\t Round |%d| complete \n", m_round);
+        #endif
+    }
+} /* end_round() */
+
+RunSummary Game::run_cycles(long long _cycles)
+{
+    RunSummary summary_;
+
+    if (m_state == State::NEW_ROUND)
+    {
+        start_round();
+        m_state = State::RUNNING;
+    }
+    if (m_state != State::RUNNING)
+        return summary_;
+
+    /* Cycles */
+    OS::Status status_ = OS::Status::ACTIVE;
+    while (summary_.cycles < _cycles)
+    {
+        status_ = batch_cycle();
+        summary_.cycles++;
+
+        if (status_ >= OS::Status::HAULTED)
+            break;
+    }
+    os_report = os_batch_cpu.report();
+
+    /* Round End */
+    if (status_ >= OS::Status::HAULTED)
+    {
+        end_round();
+        summary_.round_end = true;
+        summary_.winner    = m_results[m_round];
+    }
+    summary_.processes = os_sched.processes();
+
+    return summary_;
+} /* run_cycles() */
+
+RunSummary Game::run_round()
+{
+    return run_cycles(std::numeric_limits<long long>::max());
+}
+
+bool Game::step()
+{
+    if (m_state == State::NEW_ROUND)
+    {
+        start_round();
+        m_state = State::RUNNING;
+    }
+    if (m_state != State::RUNNING)
+        return false;
+
+    /* Round End */
+    if (batch_cycle() >= OS::Status::HAULTED)
+    {
+        os_report = os_batch_cpu.report();
+        end_round();
+    }
+    return true;
+} /* step() */
+
+Player Game::play_placed_round(std::vector<int> const &_addresses)
+{
+    if (m_state == State::WAITING || m_warriors.empty())
+        return Player::NONE;
+
+    m_round = 1;
+    m_results[m_round] = Player::NONE;
+    for (Warrior &warrior_ : m_warriors)
+    {
+        warrior_.clear_stats();
+    }
+    m_idiom_hits.fill(0);
+    #ifdef CPU_PROFILE
+    os_profiler.reset(players());   // the placed round is profiled on its own
+    #endif
+
+    os_memory.load(os_image, &asm_programs, _addresses);
+    os_sched.reset(
+        &asm_programs,
+        m_ctx.settings.max_cycles(),
+        m_ctx.settings.max_processes()
+    );
+    create_cpus();
+    update_processes();
+
+    m_state = State::RUNNING;
+    run_round();
+
+    end_game();
+    return m_results[m_round];
+} /* play_placed_round() */
 
 Player const Game::round_winner(int _round) const
 {
@@ -215,9 +387,9 @@ Player const Game::match_winner() const
     {
         Score high_score = -1,
                 points     =  0;
-        for ( int i = 1; i <= m_warriors.size(); i++ )
+        for ( int i = 0; i < m_warriors.size(); i++ )
         {
-            warrior_i = &m_warriors.at( (Player) i );
+            warrior_i = &m_warriors[i];
 
             points = warrior_i->score();
             if (points > high_score)
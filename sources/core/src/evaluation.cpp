@@ -0,0 +1,104 @@
+/// Evaluates two warriors at every starting offset across a thread pool
+
+#include <memory>
+#include "evaluation.hpp"
+#include "battle_template.hpp"
+#include "thread_pool.hpp"
+
+namespace Core
+{
+
+Evaluation::Evaluation(std::string const &_first, std::string const &_second, int _threads)
+{
+    m_files        = { _first, _second };
+    m_threads      = _threads;
+    m_first_offset = 0;
+}
+
+State Evaluation::run()
+{
+    m_winners.clear();
+    m_record = Record();
+
+    // the pair is loaded + parsed once, then packed into a single image copied into every lane
+    BattleTemplate const template_(m_files);
+    if (!template_.loaded())
+        return template_.state();
+
+    Settings const &settings_ = template_.settings();
+    if (!OS::Memory::placeable(2, settings_.min_separation(), settings_.core_size()))
+        return State::ERR_PLACEMENT;
+
+    OS::Image image_;
+    {
+        Asm::ProgramVec programs_;
+        for (int i = 0; i < 2; i++)
+        {
+            programs_.push_back( Asm::UniqProgram( new Asm::Program(template_.program(i)) ) );
+        }
+        OS::Memory memory_;
+        memory_.resize(settings_.core_size());
+        memory_.create_image(&programs_, &image_);
+    }
+
+    // second warrior from [min separation] to [size - min separation]
+    m_first_offset = settings_.min_separation();
+    int const last_offset_ = settings_.core_size() - settings_.min_separation();
+    m_winners.resize(std::max(0, last_offset_ - m_first_offset + 1), Player::NONE);
+
+    // each worker plays its offsets in lockstep lanes (a core and a copy of the programs, created once)
+    ThreadPool pool_(m_threads);
+    std::vector<std::unique_ptr<Lanes>> lanes_(pool_.threads());
+    std::vector<Asm::ProgramVec>        worker_programs(pool_.threads());
+
+    int const batches_ = (offsets() + batch_size - 1) / batch_size;
+    pool_.run(batches_, [&](int const _job, int const _worker)
+    {
+        if (!lanes_[_worker])
+        {
+            lanes_[_worker].reset( new Lanes(settings_.core_size()) );
+            for (int i = 0; i < 2; i++)
+            {
+                worker_programs[_worker].push_back( Asm::UniqProgram( new Asm::Program(template_.program(i)) ) );
+            }
+        }
+        Lanes           &cpu_       = *lanes_[_worker];
+        Asm::ProgramVec &programs_i = worker_programs[_worker];
+
+        int const begin_ = _job * batch_size,
+                  end_   = std::min(begin_ + batch_size, offsets());
+        std::vector<int> addresses_ = { 0, 0 };
+
+        for (int i = begin_; i < end_; i += Lanes::lanes)
+        {
+            int const n_lanes = std::min((int) Lanes::lanes, end_ - i);
+            for (int l = 0; l < n_lanes; l++)
+            {
+                addresses_[1] = m_first_offset + i + l;
+                cpu_.load(l, image_, &programs_i, addresses_, settings_.max_cycles(), settings_.max_processes());
+            }
+            cpu_.run();
+
+            // the last program standing wins the round, a haulted round is a draw
+            for (int l = 0; l < n_lanes; l++)
+            {
+                OS::Report const &report_ = cpu_.report(l);
+                m_winners[i + l] = (report_.status == OS::Status::EXIT) ? (Player) (report_.program + 1)
+                                                                        : Player::NONE;
+            }
+        }
+    });
+
+    for (Player const winner_ : m_winners)
+    {
+        switch (winner_)
+        {
+            case Player::P1:   m_record.wins++;   break;
+            case Player::NONE: m_record.ties++;   break;
+            default:           m_record.losses++; break;
+        }
+    }
+    return State::COMPLETE;
+}
+
+} /* ::Core */
@@ -0,0 +1,51 @@
+/// Plays independent games on a single thread, one cycle of each game in turn
+
+#include "interleaver.hpp"
+
+namespace Core
+{
+
+void Interleaver::play(std::vector<Game *> const &_games)
+{
+    // a single game has nothing to overlap, its rounds are played directly
+    if (_games.size() == 1)
+    {
+        while (_games[0]->state() != State::COMPLETE)
+        {
+            _games[0]->run_round();
+        }
+        return;
+    }
+
+    m_live.assign(_games.begin(), _games.end());
+    int n_live = m_live.size();
+
+    // prime the pipeline: the instruction of the first two turns
+    for (int i = 0; i < n_live && i < 2; i++)
+    {
+        m_live[i]->prefetch_fetch();
+    }
+
+    int turn_ = 0;
+    while (n_live > 0)
+    {
+        int const next_  = (turn_ + 1 < n_live) ? turn_ + 1 : 0,
+                  after_ = (next_ + 1 < n_live) ? next_ + 1 : 0;
+
+        // the next game's instruction was prefetched last turn, its operands can be resolved now
+        m_live[next_]->prefetch_decode();
+        m_live[after_]->prefetch_fetch();
+
+        if (!m_live[turn_]->step())
+        {
+            // complete: the last game in the rotation takes its turn
+            m_live[turn_] = m_live[--n_live];
+            if (turn_ >= n_live)
+                turn_ = 0;
+            continue;
+        }
+        turn_ = next_;
+    }
+} /* play() */
+
+} /* ::Core */
@@ -252,7 +252,7 @@ Inst assembly_to_inst(std::string &_line, LabelLinker &_linker, int _index)
 
 } /* ::assembly_to_inst() */
 
-Program *create_program(std::string _program_name, AssemblyCode &_assembly, int _max_program_insts)
+Program *create_program(std::string _program_name, AssemblyCode &_assembly, int _max_program_insts, OS::UUID _uuid)
 {
     LabelLinker linker_;             // stores label positions
     int _length = _assembly.size();  // number of program instruction
@@ -269,7 +269,7 @@ Program *create_program(std::string _program_name, AssemblyCode &_assembly, int
     }
 
     // construct program w/ default arguments
-    Program *program_ = new Program(_program_name.c_str(), _length);
+    Program *program_ = new Program(_program_name.c_str(), _length, _uuid);
 
     // clean asm code to correct format
     for (int i = 0; i < _length; i++)
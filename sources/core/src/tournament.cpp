@@ -0,0 +1,209 @@
+/// Runs a tournament of core across a thread pool
+
+#include <algorithm>
+#include <filesystem>
+#include "tournament.hpp"
+#include "battle_template.hpp"
+#include "interleaver.hpp"
+#include "thread_pool.hpp"
+
+namespace Core
+{
+
+Tournament::Tournament(WarriorFiles const &_filenames, int _melee, int _threads, uint64_t _seed, int _interleave)
+{
+    m_files      = _filenames;
+    m_melee      = std::max(2, std::min(_melee, Game::max_players()));
+    m_threads    = _threads;
+    m_seed       = _seed;
+    m_interleave = std::max(1, std::min(_interleave, max_interleave));
+
+    create_battles();
+    m_results.clear(warriors());
+}
+
+WarriorFiles Tournament::warriors_directory_files()
+{
+    WarriorFiles filenames_;
+    std::error_code err_;
+
+    for (auto const &entry_ : std::filesystem::directory_iterator(Game::warriors_directory(), err_))
+    {
+        if (entry_.is_regular_file())
+            filenames_.push_back(entry_.path().filename().string());
+    }
+    std::sort(filenames_.begin(), filenames_.end());
+
+    return filenames_;
+}
+
+void Tournament::create_battles()
+{
+    m_battles.clear();
+    if (warriors() < m_melee)
+        return;
+
+    // enumerate combinations in lexicographic order
+    Battle battle_(m_melee);
+    for (int i = 0; i < m_melee; i++)
+    {
+        battle_[i] = i;
+    }
+
+    while (true)
+    {
+        m_battles.push_back(battle_);
+
+        // find the right most warrior which can be advanced
+        int i = m_melee - 1;
+        while (i >= 0 && battle_[i] == warriors() - m_melee + i)
+        {
+            i--;
+        }
+        if (i < 0)
+            break;
+
+        battle_[i]++;
+        for (int j = i + 1; j < m_melee; j++)
+        {
+            battle_[j] = battle_[j - 1] + 1;
+        }
+    }
+}
+
+State Tournament::run()
+{
+    m_results.clear(warriors());
+
+    // every warrior is loaded + parsed once, battles select their warriors from the template
+    BattleTemplate const template_(m_files);
+    if (!template_.loaded())
+        return template_.state();
+    Settings const &settings_ = template_.settings();
+    if (!OS::Memory::placeable(m_melee, settings_.min_separation(), settings_.core_size()))
+        return State::ERR_PLACEMENT;
+
+    ThreadPool pool_(m_threads);
+    std::vector<Game>        games_(pool_.threads() * m_interleave);  // games of each worker, reused between battles
+    std::vector<Interleaver> interleavers_(pool_.threads());
+    std::vector<Results>     results_(pool_.threads());              // merged once every battle is complete
+    for (Results &worker_results_ : results_)
+    {
+        worker_results_.clear(warriors());
+    }
+
+    // each job is a group of battles, played together on the worker's thread (one cycle of each in turn)
+    int const groups_ = (battles() + m_interleave - 1) / m_interleave;
+    pool_.run(groups_, [&](int const _job, int const _worker)
+    {
+        int const begin_ = _job * m_interleave,
+                  end_   = std::min(begin_ + m_interleave, battles());
+
+        std::vector<Game *> group_;
+        for (int i = begin_; i < end_; i++)
+        {
+            Game &game_ = games_[_worker * m_interleave + (i - begin_)];
+            game_.seed(battle_seed(i));
+            game_.new_game(template_, m_battles[i]);
+            group_.push_back(&game_);
+        }
+        interleavers_[_worker].play(group_);
+
+        for (int i = begin_; i < end_; i++)
+        {
+            record_game(*group_[i - begin_], m_battles[i], results_[_worker]);
+        }
+    });
+
+    for (Results const &worker_results_ : results_)
+    {
+        m_results += worker_results_;
+    }
+    return State::COMPLETE;
+}
+
+void Tournament::record_game(Game const &_game, Battle const &_battle, Results &_results) const
+{
+    int const players_ = _battle.size();
+
+    for (int round = 1; round <= _game.max_rounds(); round++)
+    {
+        Player const winner_ = _game.round_winner(round);
+
+        // draw, the warriors still running tie with each other and beat the warriors already dead
+        // (same as the game, which only scores the survivors of a draw)
+        if (winner_ == Player::NONE)
+        {
+            for (int i = 0; i < players_; i++)
+            {
+                bool const alive_i = _game.round_survivor(round, (Player) (i + 1));
+                if (alive_i) _results.totals[_battle[i]].ties++;
+                else         _results.totals[_battle[i]].losses++;
+
+                for (int j = 0; j < players_; j++)
+                {
+                    if (i == j)
+                        continue;
+
+                    bool const alive_j = _game.round_survivor(round, (Player) (j + 1));
+                    Record &record_ = _results.matrix[_battle[i] * warriors() + _battle[j]];
+                    if (alive_i && alive_j) record_.ties++;
+                    else if (alive_i)       record_.wins++;
+                    else if (alive_j)       record_.losses++;
+                }
+            }
+            continue;
+        }
+
+        // winner beats every other warrior
+        int const w = _battle[(int) winner_ - 1];
+        _results.totals[w].wins++;
+        for (int i = 0; i < players_; i++)
+        {
+            if (_battle[i] == w)
+                continue;
+
+            _results.totals[_battle[i]].losses++;
+            _results.matrix[w * warriors() + _battle[i]].wins++;
+            _results.matrix[_battle[i] * warriors() + w].losses++;
+        }
+    }
+}
+
+std::vector<int> Tournament::standings() const
+{
+    std::vector<int> order_(warriors());
+    for (int i = 0; i < warriors(); i++)
+    {
+        order_[i] = i;
+    }
+
+    std::stable_sort(order_.begin(), order_.end(), [this](int _lhs, int _rhs)
+    {
+        return total(_lhs).score() > total(_rhs).score();
+    });
+    return order_;
+}
+
+/* Results */
+
+void Tournament::Results::clear(int _warriors)
+{
+    matrix.assign(_warriors * _warriors, Record());
+    totals.assign(_warriors, Record());
+}
+
+Tournament::Results &Tournament::Results::operator+=(Results const &_rhs)
+{
+    for (std::size_t i = 0; i < matrix.size(); i++)
+    {
+        matrix[i] += _rhs.matrix[i];
+    }
+    for (std::size_t i = 0; i < totals.size(); i++)
+    {
+        totals[i] += _rhs.totals[i];
+    }
+    return *this;
+}
+
+} /* ::Core */
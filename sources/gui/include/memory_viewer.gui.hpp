@@ -9,13 +9,13 @@ namespace Core { namespace GUI
 class MemoryViewer
 {
  public:
-    /// Stores information for a single memory address within the operating system
+    /// Stores information for a single memory address within the operating system,
+    /// kept small for large cores (the assembly is read from the core when hovered)
     struct Cell
     {
         Player      owner    = Player::NONE;              // owner of the cell
         Player      editor   = Player::NONE;              // player who last edited the cell ( Event::READ|WRITE )
         OS::Event   event    = OS::Event::NOOP;           // os event commited to the cell
-        std::string assembly = Asm::Inst().to_assembly(); // assembly instruction at the address
     };
  private:
     /* Display */
@@ -43,20 +43,14 @@ class MemoryViewer
     /// Returns true if the memory display has been initialised
     static inline bool &init_flag() { return m_init_flag; }
 
-    /// Resets all cell data to default
+    /// Resets all cell data to default, one cell for each address of the core
     static void reset();
 
     /// Updates the cell using the OS report and program
     static void update_cells();
 
-    /// Draw the memory viewer
+    /// Draw the memory viewer, only the visible rows of cells are drawn (scrolls for large cores)
     static void draw();
-
-    /// Updates the assembly string for the cell at the address given
-    static inline void update_cell_assembly(int _adr)
-    {
-        memory_cells[_adr].assembly = ptr_core->assembly_at(_adr);
-    }
 };
 
 }}/* ::Core::GUI */
@@ -33,6 +33,7 @@ void ControlPanel::run_core_systems()
 
 void ControlPanel::reset()
 {
+    ptr_core->seed(Game::random_seed());    // new placements each restart
     ptr_core->restart_game();
     MemoryViewer::reset();
 }
@@ -88,6 +89,7 @@ void ControlPanel::load_selected()
     if (filename_.size() <= 0)
         return;
 
+    ptr_core->seed(Game::random_seed());
     ptr_core->new_game(filename_);
     MemoryViewer::reset();
 
@@ -7,18 +7,14 @@ void MemoryViewer::init(Game *_core)
 {
     ptr_core = _core;
 
-    memory_cells.clear();
-    memory_cells.resize(Game::memory_size());
-
     reset();
     m_init_flag  = true;
 }
 
 void MemoryViewer::reset()
 {
-    // set all to default
-    for (int i = 0; i < memory_cells.size(); i++)
-        memory_cells[i] = MemoryViewer::Cell();
+    // set all to default (the core size is set by each game)
+    memory_cells.assign(ptr_core->memory_size(), MemoryViewer::Cell());
 
     if (ptr_core->state() == State::WAITING )
         return;
@@ -38,7 +34,6 @@ void MemoryViewer::reset()
             memory_cells[adr_].owner    = (Player) plr;
             memory_cells[adr_].editor   = Player::NONE;
             memory_cells[adr_].event    = OS::Event::EXECUTE;
-            update_cell_assembly(adr_);
             adr_++;
         }
     }
@@ -78,7 +73,6 @@ void MemoryViewer::update_cells()
 
         cell_->owner = player_;
         cell_->event = report_.exe.event;
-        update_cell_assembly(_adr);
     /** SRC: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
         _adr  = report_.src.address;
         cell_ = &memory_cells[_adr];
@@ -86,18 +80,12 @@ void MemoryViewer::update_cells()
         cell_->editor = player_;
         cell_->event  = report_.src.event;
 
-        if (_adr != report_.exe.address)
-            update_cell_assembly(_adr);
-
     /** DEST: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
         _adr  = report_.dest.address;
         cell_ = &memory_cells[_adr];
 
         cell_->editor = player_;
         cell_->event  = report_.dest.event;
-
-        if (_adr != report_.exe.address)
-            update_cell_assembly(_adr);
 }
 
 void MemoryViewer::draw()
@@ -125,12 +113,22 @@ void MemoryViewer::draw()
         Cell   *cell_;
         ImVec4 color_;
 
+        /* Visible Rows */
+        int const cols_ = std::max(1, (int) disp_cell_distro),
+                  rows_ = ((int) memory_cells.size() + cols_ - 1) / cols_;
+
+        ImGui::BeginChild("Live Memory:Cells");
+        ImGuiListClipper clipper_;
+        clipper_.Begin(rows_, disp_cell_size.y + edit_style.ItemSpacing.y);
+
         /* Create Cells */
-        int counter_   = 0;
-        while ( counter_ < memory_cells.size() )
+        while (clipper_.Step())
+        for (int row = clipper_.DisplayStart; row < clipper_.DisplayEnd; row++)
         {
+            int counter_ = row * cols_;
+
             ImGui::BeginGroup();
-            for (int col = 0; col < (int) disp_cell_distro; col++)
+            for (int col = 0; col < cols_; col++)
             {
                 if ( counter_ >= memory_cells.size() )
                     break;
@@ -163,7 +161,7 @@ void MemoryViewer::draw()
                 ImGui::Button(" ", disp_cell_size);
                     if (ImGui::IsItemHovered())
                     {
-                        ImGui::SetTooltip("%s\n|%d|", cell_->assembly.c_str(), counter_ +1);
+                        ImGui::SetTooltip("%s\n|%d|", ptr_core->assembly_at(counter_).c_str(), counter_ +1);
                     }
 
                 ImGui::PopStyleColor(push_);
@@ -173,6 +171,8 @@ void MemoryViewer::draw()
             }
             ImGui::EndGroup();
         }
+        clipper_.End();
+        ImGui::EndChild();
     }
     ImGui::End();
 
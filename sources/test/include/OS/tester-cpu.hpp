@@ -3,6 +3,8 @@
 /** CPU: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #include "cpu.hpp"
+#include "lane_cpu.hpp"
+#include "random.hpp"
 
 namespace TS { namespace _CPU_
 {
@@ -27,7 +29,8 @@ Info suite_info(Info _info)
     int constexpr min_seperation = 20,                       \
                   max_cycles     = 1000,                     \
                   max_processes  = 2,                        \
-                  n_programs     = 2;                        \
+                  n_programs     = 2,                        \
+                  seed           = 1;                        \
                                                              \
     ProgramVec programs;                                     \
                 programs.reserve(n_programs);                \
@@ -35,7 +38,7 @@ Info suite_info(Info _info)
     {                                                        \
         programs.push_back(                                  \
             UniqProgram (                                    \
-                new Program("TS::_CPU_::Program", N_INST)    \
+                new Program("TS::_CPU_::Program", N_INST, i +1) \
             )                                                \
         );                                                   \
                                                              \
@@ -45,7 +48,7 @@ Info suite_info(Info _info)
         }                                                    \
     }                                                        \
                                                              \
-    Memory memory_(&programs, min_seperation);               \
+    Memory memory_(&programs, min_seperation, seed);         \
     Scheduler sched_(&programs, max_cycles, max_processes);  \
                                                              \
     CPU core_(&memory_, &sched_);
@@ -57,10 +60,94 @@ Info suite_info(Info _info)
         core_.run_fde_cycle();
     /* TS__CPU__RUN_TEST() */
 
+/// Creates two programs from the instructions (std::vector<Inst>), placed by the seed in two identical cores:
+///     [fast]      fast_ (fast_mem, fast_sched)    HeadlessCPU, run_fde_cycle()
+///     [reference] ref_  (ref_mem,  ref_sched)     CPU, run_reference_cycle()
+#define TS__CPU__SET_DUAL_ENV(NAME, P1_INSTS, P2_INSTS, SEED)                   \
+    int constexpr min_seperation = 1000,                                        \
+                  max_cycles     = 8000,                                        \
+                  max_processes  = 8;                                           \
+                                                                                \
+    ProgramVec programs;                                                        \
+    for (std::vector<Inst> const &insts_ : { P1_INSTS, P2_INSTS })              \
+    {                                                                           \
+        programs.push_back(                                                     \
+            UniqProgram ( new Program(NAME, insts_.size(), programs.size() +1) ) \
+        );                                                                      \
+        for (Inst const &inst_ : insts_)                                        \
+        {                                                                       \
+            programs.back().get()->push(inst_);                                 \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    Memory    fast_mem (&programs, min_seperation, SEED),                       \
+              ref_mem  (&programs, min_seperation, SEED);                       \
+    Scheduler fast_sched (&programs, max_cycles, max_processes),                \
+              ref_sched  (&programs, max_cycles, max_processes);                \
+    HeadlessCPU fast_ (&fast_mem, &fast_sched);                                 \
+    CPU         ref_  (&ref_mem,  &ref_sched);
+    /* TS__CPU__SET_DUAL_ENV() */
+
+/// Plays the cycles on both cores of TS__CPU__SET_DUAL_ENV(), returns the number of reports
+/// (program, status, next pc) and memory addresses which differ
+inline int dual_mismatches(HeadlessCPU &fast_, CPU &ref_, Memory const &_fast_mem, Memory const &_ref_mem, int _n_cycles)
+{
+    int mismatches_ = 0;
+    for (int i = 0; i < _n_cycles; i++)
+    {
+        Report const fast_rpt = fast_.run_fde_cycle(),
+                     ref_rpt  = ref_.run_reference_cycle();
+
+        mismatches_ += fast_rpt.program != ref_rpt.program
+                    || fast_rpt.status  != ref_rpt.status
+                    || fast_rpt.next_pc != ref_rpt.next_pc;
+    }
+    for (int i = 0; i < _ref_mem.size(); i++)
+    {
+        mismatches_ += _fast_mem.cell(i) != _ref_mem.cell(i);
+    }
+    return mismatches_;
+}
+
+/// Returns random programs: every [code], <mod> and <admo>, values [-max value, max value]
+/// @param rng_ generator of the programs (the same stream creates the same programs)
+/// @param _n_programs number of programs
+/// @param _n_inst instructions of each program
+/// @param _max_val max magnitude of an operand's value
+inline ProgramVec random_programs(Random &rng_, int _n_programs, int _n_inst, int _max_val)
+{
+    auto operand_ = [&rng_, _max_val]() -> Inst::Operand {
+        return { (Admo) rng_.next(8), (int) rng_.next(2 * _max_val + 1) - _max_val };
+    };
+
+    ProgramVec programs_;
+    for (int i = 0; i < _n_programs; i++)
+    {
+        programs_.push_back(
+            UniqProgram ( new Program("TS::_CPU_::Random", _n_inst, i +1) )
+        );
+        for (int k = 0; k < _n_inst; k++)
+        {
+            Inst::Operand const a_ = operand_(),
+                                b_ = operand_();
+            programs_[i].get()->push(
+                Inst( {(Opcode) rng_.next(16), (Modifier) rng_.next(7)}, a_, b_ )
+            );
+        }
+    }
+    return programs_;
+}
+
 BoolInt SYSTEM_CODES();      /** TEST: all system [code]...      NOP, DAT, MOV, SPL       */
 BoolInt COMPARISION_CODES(); /** TEST: all comparision [code]... SEQ, SNE, SLT            */
 BoolInt ARITHMETIC_CODES();  /** TEST: all arithmetic [code]...  ADD, SUB, MUL, DIV, MOD  */
+BoolInt DIVISION_BY_ZERO();  /** TEST: DIV/MOD kill the process for a zero in any field pair (F, X, I) */
 BoolInt JUMP_CODES();        /** TEST: all jump [code]...        JMP, JMZ, JMN, DJN       */
+BoolInt KERNELS();           /** TEST: kernels against the reference cycle (random programs)  */
+BoolInt LANES();             /** TEST: lockstep lanes against a cpu per lane (random programs) */
+BoolInt BLOCK_CACHE();       /** TEST: compiled blocks are invalidated by writes (self-modifying) */
+BoolInt IDIOMS();            /** TEST: fused idioms against the reference cycle (overwritten idioms) */
+BoolInt PROFILE();           /** TEST: profiler counts, mixes and latency samples (CPU_PROFILE builds) */
 
 } /* ::{anonymous} */
 
@@ -18,20 +18,27 @@ Info suite_info(Info _info)
 }
 
 #define TS__MEMORY__SET_TEST_ENV()                           \
-    constexpr int min_seperation = 12;                       \
+    constexpr int min_seperation = 12,                       \
+                  seed           = 1;                        \
                                                              \
     Asm::ProgramVec programs;                                \
     programs.push_back(                                      \
-        Asm::UniqProgram ( new Asm::Program("example", 1) )  \
+        Asm::UniqProgram ( new Asm::Program("example", 1, 1) ) \
     );                                                       \
     programs[0].get()->push(Inst());                         \
                                                              \
-    Memory mars_(&programs, min_seperation);
+    Memory mars_(&programs, min_seperation, seed);
     /* TS__MEMORY__SET_TEST_ENV() */
 
 BoolInt OUT_OF_BOUNDS(); /** TEST: out of bounds (lower | upper)                        */
 BoolInt ALL_ADMOS();     /** TEST: all <admo> '#', '$', '*', '@', '<', '{', '>', '}'    */
 BoolInt ALL_MODIFIERS(); /** TEST: all <mod> '.a', '.b', '.ab', '.ba', '.f', '.x', '.i' */
+BoolInt SEEDED_PLACEMENT(); /** TEST: program placement is reproducible from the seed  */
+BoolInt LOOP_INDEX();       /** TEST: C_RAM address wrapping (mask | constant | fast modulo) */
+BoolInt NORMALISED();       /** TEST: operands are stored in [0, size), viewed as signed    */
+BoolInt IMAGE_COPY();       /** TEST: image copies match per instruction loads (wrapping)   */
+BoolInt GAP_PLACEMENT();    /** TEST: circular separation (tight | impossible placements)   */
+BoolInt CORE_SIZES();       /** TEST: core sizes set at run time (common | odd | paged)     */
 
 } /* ::{anonymous} */
 
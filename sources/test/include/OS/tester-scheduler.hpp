@@ -28,7 +28,7 @@ Info suite_info(Info _info)
     {                                                         \
         programs.push_back(                                   \
             Asm::UniqProgram (                                \
-                new Asm::Program("example", 1)                \
+                new Asm::Program("example", 1, i +1)          \
             )                                                 \
         );                                                    \
         programs[i].get()->set_address(program_counter + i);  \
@@ -38,14 +38,15 @@ Info suite_info(Info _info)
     PCB process_ = sched_.fetch_next();                       \
                    sched_.return_process(&process_);          \
                                                               \
-    int UUID_      = process_.parent_id();                    \
-    int processes_ = sched_.processes(UUID_);
+    Slot SLOT_     = process_.parent();                       \
+    int processes_ = sched_.processes(SLOT_);
     /* TS__SCHEDULER__SET_TEST_ENV() */
 
 BoolInt ROUND_ROBIN_LOOP();    /** TEST: round robin system                */
 BoolInt ADD_PRCS();            /** TEST: add  processes                    */
 BoolInt KILL_PRCS();           /** TEST: kill processes                    */
 BoolInt MAX_PROCESSES_LIMIT(); /** TEST: adding process over max           */
+BoolInt PROCESS_ORDER();       /** TEST: processes run in order (wrapping) */
 
 } /* ::{anonymous} */
 
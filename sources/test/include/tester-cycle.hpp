@@ -0,0 +1,49 @@
+#pragma once
+#include "template/test_suite.hpp"
+/** CYCLE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include "file_loader.hpp"
+#include "parser.hpp"
+#include "cpu.hpp"
+
+namespace TS { namespace _Cycle_
+{
+namespace /* {anonymous} */
+{
+    using namespace OS;
+
+Info suite_info(Info _info)
+{
+    _info.func_name = "CPU::" + _info.func_name;
+    return _info;
+}
+
+/// Loads the warriors from 'tester-warriors/' into the programs
+/// @return false: a warrior failed to load
+inline bool load_warriors(Asm::ProgramVec &programs_, std::vector<std::string> const &_filenames, int _max_insts)
+{
+    try
+    {
+        for (int i = 0; i < (int) _filenames.size(); i++)
+        {
+            Parser::AssemblyCode asm_code(
+                File_Loader::load_file_data("tester-warriors/" + _filenames[i], ASSEMBLY_COMMENT)
+            );
+            programs_.push_back(
+                Asm::UniqProgram( Parser::create_program(_filenames[i], asm_code, _max_insts, i +1) )
+            );
+        }
+    }
+    catch (const std::exception &) { return false; }
+    return true;
+}
+
+BoolInt ZERO_ALLOCATIONS(); /** TEST: no heap allocations per cycle (after warm up) */
+BoolInt ROUND_RESET();      /** TEST: reset core matches a new core, without allocating */
+BoolInt NEXT_PC();          /** TEST: the scheduler's next program counter is the next instruction executed */
+
+} /* ::{anonymous} */
+
+BoolInt ALL_TESTS(); /** ALLTESTS: ( OS::CPU cycle ) */
+
+}}/* ::TS::_Cycle_ */
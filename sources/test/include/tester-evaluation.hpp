@@ -0,0 +1,45 @@
+#pragma once
+#include "template/test_suite.hpp"
+/** EVALUATION: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <filesystem>
+#include "evaluation.hpp"
+#include "battle_template.hpp"
+
+namespace TS { namespace _Evaluation_
+{
+namespace /* {anonymous} */
+{
+    using namespace Core;
+
+Info suite_info(Info _info)
+{
+    _info.func_name = "Evaluation::" + _info.func_name;
+    return _info;
+}
+
+/// Plays the evaluation with the 'core.ini' and 'warriors/' of the resource directory
+/// @return ERR_WARRIORS: missing directory, else the state of the evaluation
+inline State run_in(std::string const &_directory, Evaluation &evaluation_)
+{
+    std::error_code err_;
+    std::filesystem::path const cwd_ = std::filesystem::current_path();
+    std::filesystem::current_path(_directory, err_);
+    if (err_)
+        return State::ERR_WARRIORS;
+
+    State const state_ = evaluation_.run();
+    std::filesystem::current_path(cwd_);
+    return state_;
+}
+
+BoolInt OFFSETS();  /** TEST: every legal offset of the second warrior is played, once */
+BoolInt THREADS();  /** TEST: winners are identical for any number of threads (and between runs) */
+BoolInt SCORE();    /** TEST: score of a known pair over every offset */
+BoolInt GAME();     /** TEST: every offset has the winner of the same round played by a game */
+
+} /* ::{anonymous} */
+
+BoolInt ALL_TESTS(); /** ALLTESTS: ( Core::Evaluation ) */
+
+}}/* ::TS::_Evaluation_ */
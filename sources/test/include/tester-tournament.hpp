@@ -0,0 +1,46 @@
+#pragma once
+#include "template/test_suite.hpp"
+/** TOURNAMENT: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <algorithm>
+#include "tournament.hpp"
+
+namespace TS { namespace _Tournament_
+{
+namespace /* {anonymous} */
+{
+    using namespace Core;
+
+Info suite_info(Info _info)
+{
+    _info.func_name = "Tournament::" + _info.func_name;
+    return _info;
+}
+
+/// Returns the number of records of the tournament which differ from the other tournament (matrix + totals)
+inline long mismatched_records(Tournament const &_lhs, Tournament const &_rhs)
+{
+    long mismatches_ = 0;
+    for (int i = 0; i < _lhs.warriors(); i++)
+    {
+        for (int j = 0; j < _lhs.warriors(); j++)
+        {
+            Record const &lhs_ = _lhs.record(i, j),
+                         &rhs_ = _rhs.record(i, j);
+            mismatches_ += lhs_.wins != rhs_.wins || lhs_.ties != rhs_.ties || lhs_.losses != rhs_.losses;
+        }
+        Record const &lhs_ = _lhs.total(i),
+                     &rhs_ = _rhs.total(i);
+        mismatches_ += lhs_.wins != rhs_.wins || lhs_.ties != rhs_.ties || lhs_.losses != rhs_.losses;
+    }
+    return mismatches_;
+}
+
+BoolInt THREADS();  /** TEST: results are identical for any number of threads (and interleaved battles) */
+BoolInt RECORDS();  /** TEST: matrix and totals agree with each other, dead warriors never tie */
+
+} /* ::{anonymous} */
+
+BoolInt ALL_TESTS(); /** ALLTESTS: ( Core::Tournament ) */
+
+}}/* ::TS::_Tournament_ */
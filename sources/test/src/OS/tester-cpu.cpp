@@ -16,7 +16,13 @@ BoolInt ALL_TESTS()
     if ( results_ += SYSTEM_CODES()      ) return results_;
     if ( results_ += COMPARISION_CODES() ) return results_;
     if ( results_ += ARITHMETIC_CODES()  ) return results_;
+    if ( results_ += DIVISION_BY_ZERO()  ) return results_;
     if ( results_ += JUMP_CODES()        ) return results_;
+    if ( results_ += KERNELS()           ) return results_;
+    if ( results_ += LANES()             ) return results_;
+    if ( results_ += BLOCK_CACHE()       ) return results_;
+    if ( results_ += IDIOMS()            ) return results_;
+    if ( results_ += PROFILE()           ) return results_;
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
     return results_;
 }
@@ -158,8 +164,8 @@ BoolInt ARITHMETIC_CODES()
 {
     TS__CPU__CONST_OPRS()
 
-    int constexpr n_inst = 7;
-    Inst const test_insts[] {
+    int constexpr n_inst = 6;
+    Inst const test_insts[n_inst] {
         Inst( {Opcode::ADD, Modifier::AB}, src_f, dest_f  ),
         Inst( {Opcode::SUB, Modifier::AB}, src_f, dest_f  ),
         Inst( {Opcode::MUL, Modifier::AB}, src_f, dest_f  ),
@@ -211,6 +217,77 @@ BoolInt ARITHMETIC_CODES()
  return HDR_.result;
 } /* ARITHMETIC_CODES() */
 
+/** TEST: DIV/MOD kill the process for a zero in any field pair (F, X, I) */
+BoolInt DIVISION_BY_ZERO()
+{
+    Inst::Operand const divisor_f  {Admo::DIRECT, 1},
+                        dividend_f {Admo::DIRECT, 2};
+
+    // plays the first cycle of a program 'code $1, $2 | dat divisor | dat dividend'
+    // returns the cycle's status and the dividend once executed
+    auto const divide = [&](Inst const &_code, Inst const &_divisor, Inst const &_dividend, bool _reference)
+    {
+        int constexpr n_inst = 3;
+        Inst const test_insts[] { _code, _divisor, _dividend };
+        TS__CPU__SET_TEST_ENV(n_inst, test_insts)
+
+        Report const rpt_ = _reference ? core_.run_reference_cycle() : core_.run_fde_cycle();
+        return std::make_pair(rpt_.status, memory_[rpt_.dest.address]);
+    };
+    auto const dat = [](int _a, int _b)
+    {
+        return Inst( {Opcode::DAT, Modifier::F}, {Admo::IMMEDIATE, _a}, {Admo::IMMEDIATE, _b} );
+    };
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+                        [0]  | code     $1, $2  |
+                        [1]  | dat      A,  B   | divisor
+                        [2]  | dat      A,  B   | dividend
+                        run_fde_cycle() | run_reference_cycle()
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"execute_arithmetic()", "DIVISION_BY_ZERO()", ""} ));
+    int E_,  A_;
+
+    #define DIVISION_BY_ZERO__RUN_TEST(CODE, DIVISOR, DIVIDEND, E_status)          \
+        for (bool reference : {false, true})                                        \
+        {                                                                           \
+            E_ = (int) E_status;                                                    \
+            A_ = (int) divide(CODE, DIVISOR, DIVIDEND, reference).first;            \
+            RUN_TEST(E_, A_, HDR_);                                                 \
+        }
+    /* DIVISION_BY_ZERO__RUN_TEST() */
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "[DIV.F] #8, #6 / #2, #3";
+    Inst const div_f ( {Opcode::DIV, Modifier::F}, divisor_f, dividend_f );
+
+    DIVISION_BY_ZERO__RUN_TEST(div_f, dat(2, 3), dat(8, 6), Status::ACTIVE)
+    for (bool reference : {false, true})
+    {
+        Inst const dividend_ = divide(div_f, dat(2, 3), dat(8, 6), reference).second;
+        E_ = 8 / 2;
+        A_ = dividend_.A.val;
+        RUN_TEST(E_, A_, HDR_);
+
+        E_ = 6 / 3;
+        A_ = dividend_.B.val;
+        RUN_TEST(E_, A_, HDR_);
+    }
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "[DIV.F] Zero B Divisor";
+    DIVISION_BY_ZERO__RUN_TEST(div_f, dat(2, 0), dat(8, 6), Status::TERMINATED)
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "[MOD.X] Zero A Divisor";
+    Inst const mod_x ( {Opcode::MOD, Modifier::X}, divisor_f, dividend_f );
+
+    DIVISION_BY_ZERO__RUN_TEST(mod_x, dat(0, 3), dat(8, 6), Status::TERMINATED)
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "[DIV.I] Zero A Dividend";
+    Inst const div_i ( {Opcode::DIV, Modifier::I}, divisor_f, dividend_f );
+
+    DIVISION_BY_ZERO__RUN_TEST(div_i, dat(2, 3), dat(0, 6), Status::TERMINATED)
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ return HDR_.result;
+} /* DIVISION_BY_ZERO() */
+
 /** TEST: all jump [code]... JMP, JMZ, JMN, DJN                    */
 BoolInt JUMP_CODES()
 {
@@ -218,8 +295,8 @@ BoolInt JUMP_CODES()
 
     Inst::Operand djn_zero  {Admo::IMMEDIATE, 1};
 
-    int constexpr n_inst = 15;
-    Inst const test_insts[] {
+    int constexpr n_inst = 13;
+    Inst const test_insts[n_inst] {
         Inst( {Opcode::JMP, Modifier::B }, jump_f, base_f   ),
         Inst( /* DAT #0, #0 */                              ),
         Inst( /* DAT #0, #0 */                              ),
@@ -281,5 +358,378 @@ BoolInt JUMP_CODES()
  return HDR_.result;
 } /* JUMP_CODES() */
 
+/** TEST: kernels against the reference cycle (random programs) */
+BoolInt KERNELS()
+{
+    int constexpr n_rounds       = 200,
+                  n_inst         = 40,
+                  n_programs     = 2,
+                  min_seperation = 100,
+                  max_cycles     = 4000,
+                  max_processes  = 16,
+                  max_val        = 20;
+
+    Random rng_(1);
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+        random programs: every [code], <mod> and <admo>, values [-20, 20]
+        [kernel]    run_fde_cycle()         | identical memory
+        [headless]  run_fde_cycle()         | and scheduler
+        [reference] run_reference_cycle()   | (headless: no events)
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"run_fde_cycle()", "KERNELS()", ""} ));
+    int E_,  A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    for (int round = 0; round < n_rounds; round++)
+    {
+        ProgramVec programs = random_programs(rng_, n_programs, n_inst, max_val);
+
+        Memory    kernel_mem   (&programs, min_seperation, round),
+                  headless_mem (&programs, min_seperation, round),
+                  ref_mem      (&programs, min_seperation, round);
+        Scheduler kernel_sched   (&programs, max_cycles, max_processes),
+                  headless_sched (&programs, max_cycles, max_processes),
+                  ref_sched      (&programs, max_cycles, max_processes);
+        CPU         kernel_   (&kernel_mem,   &kernel_sched),
+                    ref_      (&ref_mem,      &ref_sched);
+        HeadlessCPU headless_ (&headless_mem, &headless_sched);
+
+        // count every report and address that differs
+        int mismatches_ = 0;
+        Status status_  = Status::ACTIVE;
+        while (status_ < Status::HAULTED)
+        {
+            Report const kernel_rpt   = kernel_.run_fde_cycle(),
+                         headless_rpt = headless_.run_fde_cycle(),
+                         ref_rpt      = ref_.run_reference_cycle();
+
+            mismatches_ += kernel_rpt.program       != ref_rpt.program
+                        || kernel_rpt.status        != ref_rpt.status
+                        || kernel_rpt.next_pc       != ref_rpt.next_pc
+                        || kernel_rpt.exe.address   != ref_rpt.exe.address
+                        || kernel_rpt.exe.event     != ref_rpt.exe.event
+                        || kernel_rpt.src.address   != ref_rpt.src.address
+                        || kernel_rpt.src.event     != ref_rpt.src.event
+                        || kernel_rpt.dest.address  != ref_rpt.dest.address
+                        || kernel_rpt.dest.event    != ref_rpt.dest.event;
+            mismatches_ += headless_rpt.program     != ref_rpt.program
+                        || headless_rpt.status      != ref_rpt.status
+                        || headless_rpt.next_pc     != ref_rpt.next_pc;
+            status_ = ref_rpt.status;
+        }
+        for (int i = 0; i < ref_mem.size(); i++)
+        {
+            mismatches_ += kernel_mem.cell(i)   != ref_mem.cell(i);
+            mismatches_ += headless_mem.cell(i) != ref_mem.cell(i);
+        }
+
+     HDR_.info.test_desc = "Round [" + std::to_string(round) + "] mismatches";
+        E_ = 0;
+        A_ = mismatches_;
+        RUN_TEST(E_, A_, HDR_);
+    }
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* KERNELS() */
+
+/** TEST: lockstep lanes against a cpu per lane (random programs) */
+BoolInt LANES()
+{
+    int constexpr n_lanes        = 8,
+                  n_rounds       = 60,
+                  n_inst         = 40,
+                  n_programs     = 2,
+                  min_seperation = 100,
+                  max_cycles     = 4000,
+                  max_processes  = 16,
+                  max_val        = 20;
+    int const core_sizes[] = { 8192, 8000, 8001 };
+
+    Random rng_(2);
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+        random programs: every [code], <mod> and <admo>, values [-20, 20]
+        8 lanes: second program at a random offset in each lane
+        [lanes]     LaneCPU::run_cycle()    | identical memory
+        [reference] run_fde_cycle() per lane | and reports
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"LaneCPU::run_cycle()", "LANES()", ""} ));
+    int E_,  A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    for (int round = 0; round < n_rounds; round++)
+    {
+        int const size_ = core_sizes[round % 3];
+
+        ProgramVec programs = random_programs(rng_, n_programs, n_inst, max_val);
+
+        Memory      ref_mem  [n_lanes];
+        Scheduler   ref_sched[n_lanes];
+        HeadlessCPU ref_     [n_lanes];
+        LaneCPU<n_lanes> lanes_(size_);
+
+        Image image_;
+        ref_mem[0].resize(size_);
+        ref_mem[0].create_image(&programs, &image_);
+
+        for (int l = 0; l < n_lanes; l++)
+        {
+            std::vector<int> const addresses_ = {
+                0, min_seperation + (int) rng_.next(size_ - 2 * min_seperation + 1)
+            };
+            ref_mem[l].resize(size_);
+            ref_mem[l].load(&programs, addresses_);
+            ref_sched[l].reset(&programs, max_cycles, max_processes);
+            ref_[l] = HeadlessCPU(&ref_mem[l], &ref_sched[l]);
+
+            lanes_.load(l, image_, &programs, addresses_, max_cycles, max_processes);
+        }
+
+        // count every report and address that differs, lane by lane
+        int mismatches_ = 0;
+        while (lanes_.running())
+        {
+            LaneCPU<n_lanes>::LaneMask const running_ = lanes_.running();
+            lanes_.run_cycle();
+
+            for (int l = 0; l < n_lanes; l++)
+            {
+                if (!((running_ >> l) & 1))
+                    continue;
+
+                Report const &ref_rpt  = ref_[l].run_fde_cycle(),
+                             &lane_rpt = lanes_.report(l);
+                mismatches_ += lane_rpt.program != ref_rpt.program
+                            || lane_rpt.status  != ref_rpt.status
+                            || lane_rpt.next_pc != ref_mem[l].normalise(ref_rpt.next_pc);
+            }
+        }
+        for (int l = 0; l < n_lanes; l++)
+        {
+            mismatches_ += ref_[l].report().status < Status::HAULTED;
+            for (int i = 0; i < size_; i++)
+            {
+                mismatches_ += lanes_.cell(l, i) != ref_mem[l].cell(i);
+            }
+        }
+
+     HDR_.info.test_desc = "Round [" + std::to_string(round) + "] mismatches ( size " + std::to_string(size_) + " )";
+        E_ = 0;
+        A_ = mismatches_;
+        RUN_TEST(E_, A_, HDR_);
+    }
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Same Placement ( one group each cycle )";
+
+    ProgramVec programs;
+    programs.push_back( UniqProgram ( new Program("TS::_CPU_::Imp", 1, 1) ) );
+    programs.push_back( UniqProgram ( new Program("TS::_CPU_::Dwarf", 4, 2) ) );
+    programs[0].get()->push( Inst( {Opcode::MOV, Modifier::I}, {Admo::DIRECT, 0}, {Admo::DIRECT, 1} ) );
+    programs[1].get()->push( Inst( {Opcode::ADD, Modifier::AB}, {Admo::IMMEDIATE, 4}, {Admo::DIRECT, 3} ) );
+    programs[1].get()->push( Inst( {Opcode::MOV, Modifier::I}, {Admo::DIRECT, 2}, {Admo::INDIRECT_B, 2} ) );
+    programs[1].get()->push( Inst( {Opcode::JMP, Modifier::B}, {Admo::DIRECT, -2}, {Admo::IMMEDIATE, 0} ) );
+    programs[1].get()->push( Inst( {Opcode::DAT, Modifier::F}, {Admo::IMMEDIATE, 0}, {Admo::IMMEDIATE, 0} ) );
+
+    Memory memory_;
+    Image  image_;
+    memory_.resize(8000);
+    memory_.create_image(&programs, &image_);
+
+    LaneCPU<n_lanes> lanes_(8000);
+    for (int l = 0; l < n_lanes; l++)
+    {
+        lanes_.load(l, image_, &programs, { 0, 4000 }, max_cycles, max_processes);
+    }
+    lanes_.run();
+
+    E_ = (int) lanes_.cycles() - 1;   // the last cycle only fetches (end of the round)
+    A_ = (int) lanes_.groups();
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* LANES() */
+
+/** TEST: compiled blocks are invalidated by writes (self-modifying) */
+BoolInt BLOCK_CACHE()
+{
+    int constexpr n_cycles = 600;
+
+    // P1: rewrites the next instruction every loop (bombs stay clear of P2)
+    // P2: pre-decrements its own B operand before reading it (copies each target onto itself)
+    std::vector<Inst> const p1_ = {
+        Inst( {Opcode::ADD, Modifier::AB}, {Admo::IMMEDIATE, 1}, {Admo::DIRECT,    1} ),
+        Inst( {Opcode::MOV, Modifier::I},  {Admo::DIRECT,    1}, {Admo::DIRECT,   50} ),
+        Inst( {Opcode::JMP, Modifier::B},  {Admo::DIRECT,   -2}, {Admo::IMMEDIATE, 0} ),
+    };
+    std::vector<Inst> const p2_ = {
+        Inst( {Opcode::MOV, Modifier::I},  {Admo::PRE_DEC_B, 0}, {Admo::DIRECT,   40} ),
+        Inst( {Opcode::JMP, Modifier::B},  {Admo::DIRECT,   -1}, {Admo::IMMEDIATE, 0} ),
+    };
+
+    TS__CPU__SET_DUAL_ENV("TS::_CPU_::Block", p1_, p2_, 3)
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+        P1: add.ab #1, $1 | mov.i $1, $50 | jmp $-2
+        P2: mov.i <0, $40 | jmp $-1
+        [fast]      run_fde_cycle()         | identical memory
+        [reference] run_reference_cycle()   | and reports
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"run_fde_cycle()", "BLOCK_CACHE()", ""} ));
+    int E_,  A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Self-Modifying Programs Mismatches";
+    E_ = 0;
+    A_ = dual_mismatches(fast_, ref_, fast_mem, ref_mem, n_cycles);
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Rewritten Blocks Recompiled";
+    E_ = 1;
+    A_ = fast_mem.compiled_blocks() >= n_cycles / 6;  // P1's 'mov' is rewritten every loop (3 cycles of P1)
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* BLOCK_CACHE() */
+
+/** TEST: fused idioms against the reference cycle (overwritten idioms) */
+BoolInt IDIOMS()
+{
+    int constexpr n_cycles = 3000;
+
+    // P1: an imp catches up with a stone while the stone is running (its cells become imps)
+    // P2: a paper copy loop, both pointers advance through the same cell
+    std::vector<Inst> p1_ = {
+        Inst( {Opcode::SPL, Modifier::B},  {Admo::DIRECT,    9}, {Admo::IMMEDIATE,  0} ),
+        Inst( {Opcode::MOV, Modifier::I},  {Admo::DIRECT,    0}, {Admo::DIRECT,     1} ),
+    };
+    p1_.resize(9, Inst( {Opcode::DAT, Modifier::F}, {Admo::IMMEDIATE, 0}, {Admo::IMMEDIATE, 0} ));
+    p1_.insert(p1_.end(), {
+        Inst( {Opcode::ADD, Modifier::AB}, {Admo::IMMEDIATE, 4}, {Admo::DIRECT,     3} ),
+        Inst( {Opcode::MOV, Modifier::I},  {Admo::DIRECT,    2}, {Admo::INDIRECT_B, 2} ),
+        Inst( {Opcode::JMP, Modifier::B},  {Admo::DIRECT,   -2}, {Admo::IMMEDIATE,  0} ),
+        Inst( {Opcode::DAT, Modifier::F},  {Admo::IMMEDIATE, 0}, {Admo::IMMEDIATE, 12} ),
+    });
+    std::vector<Inst> const p2_ = {
+        Inst( {Opcode::MOV, Modifier::I},  {Admo::POST_INC_A, 2}, {Admo::POST_INC_B,   2} ),
+        Inst( {Opcode::DJN, Modifier::B},  {Admo::DIRECT,    -1}, {Admo::IMMEDIATE,  800} ),
+        Inst( {Opcode::DAT, Modifier::F},  {Admo::IMMEDIATE,  3}, {Admo::IMMEDIATE,  200} ),
+    };
+
+    TS__CPU__SET_DUAL_ENV("TS::_CPU_::Idiom", p1_, p2_, 5)
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+        P1: spl $9 | mov.i $0, $1 | dat #0, #0 (x7) | add.ab #4, $3 | mov.i $2, @2 | jmp $-2 | dat #0, #12
+        P2: mov.i }2, >2 | djn.b $-1, #800 | dat #3, #200
+        [fast]      run_fde_cycle()         | identical memory
+        [reference] run_reference_cycle()   | and reports
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"run_fde_cycle()", "IDIOMS()", ""} ));
+    int E_,  A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Fused Idioms Mismatches";
+    E_ = 0;
+    A_ = dual_mismatches(fast_, ref_, fast_mem, ref_mem, n_cycles);
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Imp Idiom Fused";
+    E_ = 1;
+    A_ = fast_.idiom_hits(Idiom::IMP) > 0;
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Stone Idiom Fused";
+    E_ = 1;
+    A_ = fast_.idiom_hits(Idiom::STONE) > 0;
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Paper Idiom Fused";
+    E_ = 1;
+    A_ = fast_.idiom_hits(Idiom::PAPER) > 0;
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* IDIOMS() */
+
+/** TEST: profiler counts, mixes and latency samples (CPU_PROFILE builds) */
+BoolInt PROFILE()
+{
+    int constexpr n_cycles = 400;
+
+    // P1: a stone, its bombs stay clear of P2 for n_cycles
+    // P2: an imp
+    std::vector<Inst> const p1_ = {
+        Inst( {Opcode::ADD, Modifier::AB}, {Admo::IMMEDIATE, 4}, {Admo::DIRECT,     3} ),
+        Inst( {Opcode::MOV, Modifier::I},  {Admo::DIRECT,    2}, {Admo::INDIRECT_B, 2} ),
+        Inst( {Opcode::JMP, Modifier::B},  {Admo::DIRECT,   -2}, {Admo::IMMEDIATE,  0} ),
+        Inst( {Opcode::DAT, Modifier::F},  {Admo::IMMEDIATE, 0}, {Admo::IMMEDIATE, 12} ),
+    };
+    std::vector<Inst> const p2_ = {
+        Inst( {Opcode::MOV, Modifier::I},  {Admo::DIRECT,    0}, {Admo::DIRECT,     1} ),
+    };
+
+    TS__CPU__SET_DUAL_ENV("TS::_CPU_::Profile", p1_, p2_, 7)
+
+    Profiler profiler_(programs.size());
+    fast_.profile(&profiler_);
+
+    Profiler::Histogram hist_;
+    for (long long ns_ : { 3, 3, 3, 100 })
+    {
+        hist_.add(ns_);
+    }
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+        P1: add.ab #4, $3 | mov.i $2, @2 | jmp $-2 | dat #0, #12
+        P2: mov.i $0, $1
+        [fast]      run_fde_cycle()         | identical memory (profiled)
+        [reference] run_reference_cycle()   | and reports
+        histogram:  3, 3, 3, 100 ns
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"run_fde_cycle()", "PROFILE()", ""} ));
+    int E_,  A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Profiled Cycles Mismatches";
+    E_ = 0;
+    A_ = dual_mismatches(fast_, ref_, fast_mem, ref_mem, n_cycles);
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Histogram Median Bucket";
+    E_ = 4;
+    A_ = (int) hist_.percentile(50);
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Histogram 99th Percentile Bucket";
+    E_ = 128;
+    A_ = (int) hist_.percentile(99);
+    RUN_TEST(E_, A_, HDR_);
+
+    // nothing is recorded unless built with CPU_PROFILE
+    int const profiled_cycles_ = Profiler::enabled ? n_cycles : 0;
+
+ HDR_.info.test_desc = "Cycles Recorded";
+    E_ = profiled_cycles_;
+    A_ = (int) profiler_.cycles();
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Imp Instruction Count";
+    E_ = profiled_cycles_ / 2;
+    A_ = (int) profiler_.count(Opcode::MOV, Modifier::I, Admo::DIRECT, Admo::DIRECT);
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Stone Instruction Mix";
+    E_ = profiled_cycles_ / 2;
+    A_ = (int) (profiler_.mix(0, Opcode::ADD) + profiler_.mix(0, Opcode::MOV) + profiler_.mix(0, Opcode::JMP));
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Stone Instruction Count";
+    E_ = (int) profiler_.mix(0, Opcode::MOV);
+    A_ = (int) profiler_.count(Opcode::MOV, Modifier::I, Admo::DIRECT, Admo::INDIRECT_B);
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Latencies Sampled";
+    E_ = (profiled_cycles_ + Profiler::sample_period - 1) / Profiler::sample_period;
+    A_ = (int) (profiler_.decode().samples + profiler_.execute().samples) / 2;
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* PROFILE() */
+
 } /* ::{anonymous}  */
 }} /* ::TS::_CPU_ */
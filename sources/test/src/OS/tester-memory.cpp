@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cstdlib>
 #include "OS/tester-memory.hpp"
 
 int main(int argc, char const *argv[])
@@ -16,6 +18,12 @@ BoolInt ALL_TESTS()
     if (results_ += OUT_OF_BOUNDS() ) return results_;
     if (results_ += ALL_ADMOS()     ) return results_;
     if (results_ += ALL_MODIFIERS() ) return results_;
+    if (results_ += SEEDED_PLACEMENT()) return results_;
+    if (results_ += LOOP_INDEX()      ) return results_;
+    if (results_ += NORMALISED()      ) return results_;
+    if (results_ += IMAGE_COPY()      ) return results_;
+    if (results_ += GAP_PLACEMENT()   ) return results_;
+    if (results_ += CORE_SIZES()      ) return results_;
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
     return results_;
 }
@@ -31,10 +39,11 @@ BoolInt OUT_OF_BOUNDS()
                 upper_bounds = mars_.size() - 1;
 
     int test_index;
-    Inst  &lower_ = mars_[lower_bounds],
-          &upper_ = mars_[upper_bounds];
+    Cell  &lower_ = mars_.cell(lower_bounds),
+          &upper_ = mars_.cell(upper_bounds);
 
-    lower_.OP.code = upper_.OP.code = Opcode::NOP;
+    lower_.set_code(Opcode::NOP);
+    upper_.set_code(Opcode::NOP);
 
  /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
                         [0]:         nop  0, 0  | [lower_]
@@ -53,11 +62,11 @@ BoolInt OUT_OF_BOUNDS()
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "Lower Bounds ( RAM[-1] )";
 
-    OUT_OF_BOUNDS__TEST(lower_.OP.code, lower_bounds -1)
+    OUT_OF_BOUNDS__TEST(lower_.code(), lower_bounds -1)
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "Upper Bounds ( RAM[size()] )";
 
-    OUT_OF_BOUNDS__TEST(upper_.OP.code, upper_bounds +1)
+    OUT_OF_BOUNDS__TEST(upper_.code(), upper_bounds +1)
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
     return HDR_.result;
 } /* ::OUT_OF_BOUNDS() */
@@ -66,21 +75,21 @@ BoolInt OUT_OF_BOUNDS()
 BoolInt ALL_ADMOS()
 {
     TS__MEMORY__SET_TEST_ENV()
-    Inst const _reset_ = Inst();
+    Cell const _reset_ = Cell();
 
     int _index = 0;
-    Inst &_exe = mars_[_index];             // [EXE]
-    _exe.A.val = 1;
-    _exe.B.val = 2;
+    Register _exe (_index, &mars_.cell(_index));                // [EXE]
+    _exe.set_a(1);
+    _exe.set_b(2);
 
-    Inst &_src = mars_[_exe.A.val];         // [SRC]
-    _src.A.val = 3;
+    Register _src (_exe.a(), &mars_.cell(_exe.a()));            // [SRC]
+    _src.set_a(3);
 
-    Inst &_dest = mars_[_exe.B.val];        // [DEST]
-    _dest.B.val = 4;
+    Register _dest(_exe.b(), &mars_.cell(_exe.b()));            // [DEST]
+    _dest.set_b(4);
 
     Admo test_admo;
-    ControlUnit ctrl ( {_index, &_exe} );
+    ControlUnit ctrl ( _exe );
 
  /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
                         [0]: dat (?)1, (?)2    |           [EXE]
@@ -95,11 +104,12 @@ BoolInt ALL_ADMOS()
     int E__src,  A__src;
     int E__dest, A__dest;
 
-    #define ALL_ADMOS__SET_TEST(E_1, E_2)       \
-        E__src   = E_1;                         \
-        E__dest  = E_2;                         \
-                                                \
-        _exe.A.admo = _exe.B.admo = test_admo;
+    #define ALL_ADMOS__SET_TEST(E_1, E_2)                 \
+        E__src   = E_1;                                   \
+        E__dest  = E_2;                                   \
+                                                          \
+        _exe.cell->set_admo(InstField::A, test_admo);     \
+        _exe.cell->set_admo(InstField::B, test_admo);
     /* # ALL_ADMOS__SET_TEST() */
 
     #define ALL_ADMOS__RUN_TEST(A_1, A_2)                     \
@@ -115,9 +125,9 @@ BoolInt ALL_ADMOS()
         RUN_TEST(E__src,  A__src, HDR_);                      \
         RUN_TEST(E__dest, A__dest, HDR_);                     \
                                                               \
-        _src = _dest = _reset_;                               \
-        _src.A.val   = 3;                                     \
-        _dest.B.val  = 4;
+        *_src.cell = *_dest.cell = _reset_;                   \
+        _src.set_a(3);                                        \
+        _dest.set_b(4);
     /* # ALL_ADMOS__RUN_TEST() */
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "IMMEDIATE ( '#' )";
@@ -131,15 +141,15 @@ BoolInt ALL_ADMOS()
 
     test_admo = Admo::DIRECT;                       // [SRC, DEST]
 
-    ALL_ADMOS__SET_TEST(_exe.A.val,     _exe.B.val)
+    ALL_ADMOS__SET_TEST(_exe.a(), _exe.b())
     ALL_ADMOS__RUN_TEST(ctrl.SRC.address, ctrl.DEST.address)
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "INDIRECT_A ( '*' )";
 
     test_admo = Admo::INDIRECT_A;   // [SRC  + A]
                                     // [DEST + A]
-    ALL_ADMOS__SET_TEST(_exe.A.val +  _src.A.val,
-                            _exe.B.val + _dest.A.val)
+    ALL_ADMOS__SET_TEST(_exe.a() +  _src.a(),
+                            _exe.b() + _dest.a())
     ALL_ADMOS__RUN_TEST(ctrl.SRC.address,
                             ctrl.DEST.address)
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -147,38 +157,38 @@ BoolInt ALL_ADMOS()
 
     test_admo = Admo::INDIRECT_B;   // [SRC  + B]
                                     // [DEST + B]
-    ALL_ADMOS__SET_TEST(_exe.A.val +  _src.B.val,
-                            _exe.B.val + _dest.B.val)
+    ALL_ADMOS__SET_TEST(_exe.a() +  _src.b(),
+                            _exe.b() + _dest.b())
     ALL_ADMOS__RUN_TEST(ctrl.SRC.address,
                             ctrl.DEST.address)
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "PRE_DEC_A ( '{' )";
 
-    test_admo = Admo::PRE_DEC_A;    // (*) + (--A)
+    test_admo = Admo::PRE_DEC_A;    // (*) + (--A)     values wrap to [0, size)
 
-    ALL_ADMOS__SET_TEST(_src.A.val - 1, _dest.A.val - 1)
-    ALL_ADMOS__RUN_TEST(_src.A.val,     _dest.A.val)
+    ALL_ADMOS__SET_TEST(mars_.normalise(_src.a() - 1), mars_.normalise(_dest.a() - 1))
+    ALL_ADMOS__RUN_TEST(_src.a(),     _dest.a())
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "PRE_DEC_B ( '<' )";
 
     test_admo = Admo::PRE_DEC_B;    // (@) + (--B)
 
-    ALL_ADMOS__SET_TEST(_src.B.val - 1, _dest.B.val - 1)
-    ALL_ADMOS__RUN_TEST(_src.B.val,     _dest.B.val)
+    ALL_ADMOS__SET_TEST(mars_.normalise(_src.b() - 1), mars_.normalise(_dest.b() - 1))
+    ALL_ADMOS__RUN_TEST(_src.b(),     _dest.b())
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "POST_INC_A ( '}' )";
 
     test_admo = Admo::POST_INC_A;    // (*) + (A++)
 
-    ALL_ADMOS__SET_TEST(_src.A.val + 1, _dest.A.val + 1)
-    ALL_ADMOS__RUN_TEST(_src.A.val,     _dest.A.val)
+    ALL_ADMOS__SET_TEST(_src.a() + 1, _dest.a() + 1)
+    ALL_ADMOS__RUN_TEST(_src.a(),     _dest.a())
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "POST_INC_B ( '>' )";
 
     test_admo = Admo::POST_INC_B;   // (@) + (B++)
 
-    ALL_ADMOS__SET_TEST(_src.B.val + 1, _dest.B.val + 1)
-    ALL_ADMOS__RUN_TEST(_src.B.val,     _dest.B.val)
+    ALL_ADMOS__SET_TEST(_src.b() + 1, _dest.b() + 1)
+    ALL_ADMOS__RUN_TEST(_src.b(),     _dest.b())
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
     return HDR_.result;
 } /* ALL_ADMOS() */
@@ -189,18 +199,18 @@ BoolInt ALL_MODIFIERS()
     TS__MEMORY__SET_TEST_ENV()
 
     int _index = 0;
-    Register const _exe (_index, &mars_[_index]);               //  [EXE]
-                   _exe.OP->code = Opcode::MOV;
-                   _exe.A->val   = 1;
-                   _exe.B->val   = 2;
+    Register _exe (_index, &mars_.cell(_index));                //  [EXE]
+             _exe.cell->set_code(Opcode::MOV);
+             _exe.set_a(1);
+             _exe.set_b(2);
 
-    Register const _src( _exe.A->val, &mars_[_exe.A->val]);     //  [SRC]
-                   _src.A->val = 3;
-                   _src.B->val = 6;
+    Register _src( _exe.a(), &mars_.cell(_exe.a()));            //  [SRC]
+             _src.set_a(3);
+             _src.set_b(6);
 
-    Register const _dest(_exe.B->val, &mars_[_exe.B->val]);     //  [DEST]
-                   _dest.A->val = 9;
-                   _dest.B->val = 12;
+    Register _dest(_exe.b(), &mars_.cell(_exe.b()));            //  [DEST]
+             _dest.set_a(9);
+             _dest.set_b(12);
 
     Modifier test_modifier;
     ControlUnit ctrl (_exe, _src, _dest);
@@ -217,7 +227,7 @@ BoolInt ALL_MODIFIERS()
     #define ALL_MODIFIERS__SET_TEST(E_1, E_2)        \
         E__src   = E_1;                              \
         E__dest  = E_2;                              \
-        _exe.OP->mod = _exe.OP->mod = test_modifier;
+        _exe.cell->set_mod(test_modifier);
     /* # ::..__SET_TEST() */
 
     #define ALL_MODIFIERS__RUN_TEST(A_1, A_2)  \
@@ -235,49 +245,49 @@ BoolInt ALL_MODIFIERS()
 
     test_modifier = Modifier::A;     // [SRC] A -> A [DEST]
 
-    ALL_MODIFIERS__SET_TEST(    _src.A->val,     _dest.A->val)
-    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.A->val, ctrl.DEST.A->val)
+    ALL_MODIFIERS__SET_TEST(    _src.a(),     _dest.a())
+    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.a(), ctrl.DEST.a())
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "( '.B' )";
 
     test_modifier = Modifier::B;     // [SRC] B -> B [DEST]
 
-    ALL_MODIFIERS__SET_TEST(    _src.B->val,     _dest.B->val)
-    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.A->val, ctrl.DEST.A->val)
+    ALL_MODIFIERS__SET_TEST(    _src.b(),     _dest.b())
+    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.a(), ctrl.DEST.a())
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "( '.AB' )";
 
     test_modifier = Modifier::AB;    // [SRC] A -> B [DEST]
 
-    ALL_MODIFIERS__SET_TEST(    _src.A->val,     _dest.B->val)
-    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.A->val, ctrl.DEST.A->val)
+    ALL_MODIFIERS__SET_TEST(    _src.a(),     _dest.b())
+    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.a(), ctrl.DEST.a())
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "( '.BA' )";
 
     test_modifier = Modifier::BA;    // [SRC] B -> A [DEST]
 
-    ALL_MODIFIERS__SET_TEST(    _src.B->val,     _dest.A->val)
-    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.A->val, ctrl.DEST.A->val)
+    ALL_MODIFIERS__SET_TEST(    _src.b(),     _dest.a())
+    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.a(), ctrl.DEST.a())
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "( '.F' )";
 
     test_modifier = Modifier::F;    // [SRC] A,B -> A,B [DEST]
 
-    ALL_MODIFIERS__SET_TEST(    _src.A->val,     _dest.A->val)
-    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.A->val, ctrl.DEST.A->val)
+    ALL_MODIFIERS__SET_TEST(    _src.a(),     _dest.a())
+    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.a(), ctrl.DEST.a())
 
-    ALL_MODIFIERS__SET_TEST(    _src.B->val,     _dest.B->val)
-    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.B->val, ctrl.DEST.B->val)
+    ALL_MODIFIERS__SET_TEST(    _src.b(),     _dest.b())
+    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.b(), ctrl.DEST.b())
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "( '.X' )";
 
     test_modifier = Modifier::X;    // [SRC] A,B -> B,A [DEST]
 
-    ALL_MODIFIERS__SET_TEST(    _src.A->val,     _dest.B->val)
-    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.A->val, ctrl.DEST.A->val)
+    ALL_MODIFIERS__SET_TEST(    _src.a(),     _dest.b())
+    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.a(), ctrl.DEST.a())
 
-    ALL_MODIFIERS__SET_TEST(    _src.B->val,     _dest.A->val)
-    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.B->val, ctrl.DEST.B->val)
+    ALL_MODIFIERS__SET_TEST(    _src.b(),     _dest.a())
+    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.b(), ctrl.DEST.b())
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "( '.I' )";
 
@@ -286,14 +296,355 @@ BoolInt ALL_MODIFIERS()
     ALL_MODIFIERS__SET_TEST((int) ModifierType::FULL, 0)
     ALL_MODIFIERS__RUN_TEST((int)  ctrl.TYPE.mod, 0)
 
-    ALL_MODIFIERS__SET_TEST(    _src.A->val,     _dest.A->val)
-    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.A->val, ctrl.DEST.A->val)
+    ALL_MODIFIERS__SET_TEST(    _src.a(),     _dest.a())
+    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.a(), ctrl.DEST.a())
 
-    ALL_MODIFIERS__SET_TEST(    _src.B->val,     _dest.B->val)
-    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.B->val, ctrl.DEST.B->val)
+    ALL_MODIFIERS__SET_TEST(    _src.b(),     _dest.b())
+    ALL_MODIFIERS__RUN_TEST(ctrl.SRC.b(), ctrl.DEST.b())
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
     return HDR_.result;
 } /* ALL_MODIFIERS() */
 
+/** TEST: program placement is reproducible from the seed */
+BoolInt SEEDED_PLACEMENT()
+{
+    TS__MEMORY__SET_TEST_ENV()
+
+    programs.push_back(
+        Asm::UniqProgram ( new Asm::Program("example", 1, 2) )
+    );
+    programs[1].get()->push(Inst());
+    mars_ = Memory(&programs, min_seperation, seed);
+
+    int const adr_1 = programs[0].get()->address(),
+              adr_2 = programs[1].get()->address();
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+                        [adr_1]: dat  0, 0  | "example" (seed)
+                        [adr_2]: dat  0, 0  | "example" (seed)
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"Memory()", "SEEDED_PLACEMENT()", ""} ));
+    int E_, A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Same Seed ( same addresses )";
+
+    Memory same_(&programs, min_seperation, seed);
+
+    E_ = adr_1;
+    A_ = programs[0].get()->address();
+    RUN_TEST(E_, A_, HDR_);
+
+    E_ = adr_2;
+    A_ = programs[1].get()->address();
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Other Stream ( new addresses )";
+
+    Memory other_(&programs, min_seperation, Random::stream(seed, 1));
+    HDR_.cmp_op = CMP_OP::NEQ;
+
+    E_ = adr_1;
+    A_ = programs[0].get()->address();
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* SEEDED_PLACEMENT() */
+
+/** TEST: C_RAM address wrapping (mask | constant | fast modulo) */
+BoolInt LOOP_INDEX()
+{
+    C_RAM<int> const pow2_ (8192),      // mask
+                     const_(8000),      // modulo by a constant
+                     large_(55440),
+                     odd_  (8001);      // fast modulo
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+                        addresses [-3 * size, 3 * size], extremes
+                        expected: ((address % size) + size) % size
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"C_RAM::loop_index()", "LOOP_INDEX()", ""} ));
+    int E_, A_;
+
+    #define LOOP_INDEX__CHECK(RAM, ADR)                                 \
+        E_ = (int) ((((ADR) % RAM.size()) + RAM.size()) % RAM.size());  \
+        A_ = RAM.loop_index((int) (ADR));                               \
+        RUN_TEST(E_, A_, HDR_);
+    /* ::LOOP_INDEX__CHECK() */
+
+    #define LOOP_INDEX__TEST(RAM)                                       \
+        for (long long adr = -3LL * RAM.size(); adr <= 3LL * RAM.size(); adr++) \
+        {                                                               \
+            LOOP_INDEX__CHECK(RAM, adr)                                 \
+        }                                                               \
+        LOOP_INDEX__CHECK(RAM, (long long) INT32_MIN)                   \
+        LOOP_INDEX__CHECK(RAM, (long long) INT32_MAX)
+    /* ::LOOP_INDEX__TEST() */
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Power of Two ( 8192 )";
+
+    LOOP_INDEX__TEST(pow2_)
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Constant ( 8000 | 55440 )";
+
+    LOOP_INDEX__TEST(const_)
+    LOOP_INDEX__TEST(large_)
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Fast Modulo ( 8001 )";
+
+    LOOP_INDEX__TEST(odd_)
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* LOOP_INDEX() */
+
+/** TEST: operands are stored in [0, size), viewed as signed */
+BoolInt NORMALISED()
+{
+    TS__MEMORY__SET_TEST_ENV()
+
+    (*programs[0].get())[0] = Inst( {Opcode::DAT, Modifier::F},
+                                    {Admo::IMMEDIATE, -1},
+                                    {Admo::IMMEDIATE, mars_.size() + 5} );
+    mars_ = Memory(&programs, min_seperation, seed);
+
+    int const adr_ = programs[0].get()->address();
+    Cell const &cell_ = mars_.cell(adr_);
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+                        [adr_]: dat  #-1, #(size + 5)  | loaded
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"normalise()", "NORMALISED()", ""} ));
+    int E_, A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Stored ( [0, size) )";
+
+    E_ = mars_.size() - 1;
+    A_ = cell_.val(InstField::A);
+    RUN_TEST(E_, A_, HDR_);
+
+    E_ = 5;
+    A_ = cell_.val(InstField::B);
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Decoded View ( signed )";
+
+    E_ = -1;
+    A_ = mars_[adr_].A.val;
+    RUN_TEST(E_, A_, HDR_);
+
+    E_ = 5;
+    A_ = mars_[adr_].B.val;
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* NORMALISED() */
+
+/** TEST: image copies match per instruction loads (wrapping) */
+BoolInt IMAGE_COPY()
+{
+    TS__MEMORY__SET_TEST_ENV()
+
+    int constexpr n_insts = 10;
+    programs.push_back(
+        Asm::UniqProgram ( new Asm::Program("example", n_insts, 2) )
+    );
+    for (int i = 0; i < n_insts; i++)
+    {
+        programs[1].get()->push(
+            Inst( {Opcode::MOV, Modifier::I}, {Admo::DIRECT, i - n_insts}, {Admo::PRE_DEC_B, i} )
+        );
+    }
+    Image image_;
+    mars_.create_image(&programs, &image_);
+
+    Memory image_mem_;
+    auto mismatches_ = [&]() -> int {
+        int count_ = 0;
+        for (int i = 0; i < mars_.size(); i++)
+        {
+            count_ += image_mem_.cell(i) != mars_.cell(i);
+        }
+        return count_;
+    };
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+                        "example" (1 inst), "example" (10 insts)
+                        [load]  per instruction  | identical core
+                        [image] block copy       |
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"load()", "IMAGE_COPY()", ""} ));
+    int E_, A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Seeded Placement ( reset )";
+
+    for (uint64_t seed_i = 0; seed_i < 16; seed_i++)
+    {
+        mars_.reset(&programs, min_seperation, seed_i);
+        image_mem_.reset(image_, &programs, min_seperation, seed_i);
+
+        E_ = 0;
+        A_ = mismatches_();
+        RUN_TEST(E_, A_, HDR_);
+    }
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Wraps Around The End ( load )";
+
+    std::vector<int> const addresses_ = { 0, mars_.size() - n_insts / 2 };
+    mars_.load(&programs, addresses_);
+    image_mem_.load(image_, &programs, addresses_);
+
+    E_ = 0;
+    A_ = mismatches_();
+    RUN_TEST(E_, A_, HDR_);
+
+    E_ = (int) Opcode::MOV;
+    A_ = (int) image_mem_.cell(n_insts / 2 - 1).code();
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* IMAGE_COPY() */
+
+/** TEST: circular separation (tight | impossible placements) */
+BoolInt GAP_PLACEMENT()
+{
+    int constexpr n_programs = 9,
+                  n_seeds    = 1000;
+
+    Asm::ProgramVec programs;
+    for (int i = 0; i < n_programs; i++)
+    {
+        programs.push_back(
+            Asm::UniqProgram ( new Asm::Program("example", 1, i +1) )
+        );
+        programs[i].get()->push(Inst());
+    }
+    Memory mars_ (&programs, 0, 0);
+
+    // returns the smallest distance between two programs, measured around the core
+    auto min_distance_ = [&programs, &mars_]() -> int {
+        int min_ = mars_.size();
+        for (int i = 0; i < n_programs; i++)
+        {
+            for (int k = i + 1; k < n_programs; k++)
+            {
+                int const dist_ = std::abs(programs[i].get()->address() - programs[k].get()->address());
+                min_ = std::min(min_, std::min(dist_, mars_.size() - dist_));
+            }
+        }
+        return min_;
+    };
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+                        9 programs, 1000 seeds
+                        separation: 100 | size / 9 (tight) | size / 8 (impossible)
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"reset()", "GAP_PLACEMENT()", ""} ));
+    int E_, A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Separated Around The Core ( 100 | tight )";
+
+    int const separations_[] = { 100, mars_.size() / n_programs };
+    for (int const sep_ : separations_)
+    {
+        int failures_ = 0;
+        for (uint64_t seed = 0; seed < n_seeds; seed++)
+        {
+            failures_ += !mars_.reset(&programs, sep_, seed);
+            failures_ += min_distance_() < sep_;
+        }
+        E_ = 0;
+        A_ = failures_;
+        RUN_TEST(E_, A_, HDR_);
+    }
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Impossible ( reported, spaced evenly )";
+
+    int const impossible_ = mars_.size() / (n_programs - 1);
+
+    E_ = false;
+    A_ = mars_.placeable(n_programs, impossible_);
+    RUN_TEST(E_, A_, HDR_);
+
+    E_ = false;
+    A_ = mars_.reset(&programs, impossible_, 0);
+    RUN_TEST(E_, A_, HDR_);
+
+    E_ = mars_.size() / n_programs;
+    A_ = min_distance_();
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* GAP_PLACEMENT() */
+
+/** TEST: core sizes set at run time (common | odd | paged) */
+BoolInt CORE_SIZES()
+{
+    TS__MEMORY__SET_TEST_ENV()
+
+    (*programs[0].get())[0] = Inst( {Opcode::MOV, Modifier::I},
+                                    {Admo::DIRECT, -1},
+                                    {Admo::DIRECT, 1} );
+    int const sizes_[] = { 8000, 8192, 55440, 3000001, 1 << 22 };
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+                        "example" (mov.i $-1, $1) | resized, reset each size
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"resize()", "CORE_SIZES()", ""} ));
+    int E_, A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    for (int const size_ : sizes_)
+    {
+     HDR_.info.test_desc = "Size ( " + std::to_string(size_) + " )";
+
+        mars_.cell(0).set_code(Opcode::SPL);    // dirty core, cleared by the reset
+        mars_.resize(size_);
+        mars_.reset(&programs, min_seperation, seed);
+
+        int const adr_ = programs[0].get()->address();
+
+        E_ = size_;
+        A_ = mars_.size();
+        RUN_TEST(E_, A_, HDR_);
+
+        E_ = size_ - 1;
+        A_ = mars_.cell(adr_).val(InstField::A);
+        RUN_TEST(E_, A_, HDR_);
+
+        E_ = (int) Opcode::MOV;
+        A_ = (int) mars_.cell(adr_ + size_).code();
+        RUN_TEST(E_, A_, HDR_);
+
+        int dirty_ = 0;
+        for (int i = 0; i < size_; i++)
+        {
+            dirty_ += (i != adr_) && (mars_.cell(i) != Cell());
+        }
+        E_ = 0;
+        A_ = dirty_;
+        RUN_TEST(E_, A_, HDR_);
+    }
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Invalid Size ( default )";
+
+    mars_.resize(Memory::max_size() + 1);
+
+    E_ = 8192;
+    A_ = mars_.size();
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Paged ( >= 1 MiB )";
+
+    #ifdef C_RAM_PAGED
+    E_ = true;
+    A_ = C_RAM<Cell>(1 << 22).paged();
+    RUN_TEST(E_, A_, HDR_);
+    #endif
+
+    E_ = false;
+    A_ = C_RAM<Cell>(8192).paged();
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* CORE_SIZES() */
+
 } /* ::{anonymous}  */
 }} /* ::TS::_Memory_ */
@@ -17,6 +17,7 @@ BoolInt ALL_TESTS()
     if ( results_ += ADD_PRCS()            ) return results_;
     if ( results_ += KILL_PRCS()           ) return results_;
     if ( results_ += MAX_PROCESSES_LIMIT() ) return results_;
+    if ( results_ += PROCESS_ORDER()       ) return results_;
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
     return results_;
 } /* ALL_TESTS() */
@@ -36,7 +37,7 @@ BoolInt ROUND_ROBIN_LOOP()
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "Complete Multiple Index Rotations";
 
-    E_ = UUID_;
+    E_ = SLOT_;
 
     n_queues = sched_.programs();
     for (int i = 0; i < (n_queues * n_queues); i++)
@@ -44,7 +45,7 @@ BoolInt ROUND_ROBIN_LOOP()
         process_ = sched_.fetch_next();
                    sched_.return_process(&process_);
     }
-    A_ = process_.parent_id();
+    A_ = process_.parent();
     RUN_TEST(E_, A_, HDR_);
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
  HDR_.info.test_desc = "Deplete Round Robin";
@@ -63,7 +64,7 @@ BoolInt ROUND_ROBIN_LOOP()
     A_ = sched_.programs();
     RUN_TEST(E_, A_, HDR_);
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
- HDR_.info.test_desc = "Exit on Last UUID";
+ HDR_.info.test_desc = "Exit on Last Program";
 
     E_ = (int) Status::EXIT;
 
@@ -99,9 +100,21 @@ BoolInt ADD_PRCS()
 
     while (processes_++ != sched_.max_processes())
     {
-        sched_.add_process(UUID_, 0);
+        sched_.add_process(SLOT_, 0);
     }
-    A_ = sched_.processes(UUID_);
+    A_ = sched_.processes(SLOT_);
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Total Processes (Unchanged By Fetch/Return)";
+
+    E_ = sched_.max_processes() + (n_programs - 1);
+
+    for (int i = 0; i < sched_.max_processes(); i++)
+    {
+        process_ = sched_.fetch_next();
+                   sched_.return_process(&process_);
+    }
+    A_ = sched_.processes();
     RUN_TEST(E_, A_, HDR_);
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
     return HDR_.result;
@@ -113,9 +126,9 @@ BoolInt KILL_PRCS()
     int constexpr n_programs = 3;
     TS__SCHEDULER__SET_TEST_ENV(n_programs)
 
-    while (sched_.processes(UUID_) != sched_.max_processes())
+    while (sched_.processes(SLOT_) != sched_.max_processes())
     {
-        sched_.add_process(UUID_, 0);
+        sched_.add_process(SLOT_, 0);
     }
 
  /** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -135,7 +148,7 @@ BoolInt KILL_PRCS()
         sched_.kill_process(&process_);
         sched_.kill_process(&process_);
 
-    A_ = sched_.processes(UUID_);
+    A_ = sched_.processes(SLOT_);
     RUN_TEST(E_, A_, HDR_);
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
     return HDR_.result;
@@ -159,13 +172,56 @@ BoolInt MAX_PROCESSES_LIMIT()
 
     while (processes_++ != test_limit)
     {
-        sched_.add_process(UUID_, 0);
+        sched_.add_process(SLOT_, 0);
     }
-    A_ = sched_.processes(UUID_);
+    A_ = sched_.processes(SLOT_);
     RUN_TEST(E_, A_, HDR_);
  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
     return HDR_.result;
 } /* MAX_PROCESSES_LIMIT() */
 
+/** TEST: processes run in order (wrapping) */
+BoolInt PROCESS_ORDER()
+{
+    int constexpr n_programs = 1;
+    TS__SCHEDULER__SET_TEST_ENV(n_programs)
+
+    // fill the queue, process [i] has program counter [i]
+    sched_ = Scheduler(&programs, max_cycles, max_processes);
+    process_ = sched_.fetch_next();
+               sched_.kill_process(&process_);
+    for (int i = 0; i < sched_.max_processes(); i++)
+    {
+        sched_.add_process(SLOT_, i);
+    }
+
+ /** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"fetch_next()", "PROCESS_ORDER()", ""} ));
+    int E_, A_;
+    int pc_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Fetch Order Over Multiple Rotations";
+
+    // each process returns to the back of the queue, rotating around the ring buffer
+    E_ = 0;
+    A_ = 0;
+    for (int i = 0; i < sched_.max_processes() * 3; i++)
+    {
+        process_ = sched_.fetch_next();
+        process_ >> pc_;
+        A_ += pc_ != i % sched_.max_processes();
+        sched_.return_process(&process_);
+    }
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Processes Kept";
+
+    E_ = sched_.max_processes();
+    A_ = sched_.processes(SLOT_);
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* PROCESS_ORDER() */
+
 } /* ::{anonymous}  */
 }}/* ::TS::_Scheduler_ */
@@ -0,0 +1,249 @@
+#include <cstdlib>
+#include <new>
+#include "tester-cycle.hpp"
+
+/* Allocation Counter: replaces the global operator new for this tester only */
+namespace
+{
+    bool track_allocations = false;     // count allocations while true
+    long allocations       = 0;         // allocations counted
+}
+
+void *operator new(std::size_t _size)
+{
+    if (track_allocations)
+        allocations++;
+
+    void *ptr_ = std::malloc(_size ? _size : 1);
+    if (ptr_ == nullptr)
+        throw std::bad_alloc();
+    return ptr_;
+}
+void *operator new[](std::size_t _size)                   { return operator new(_size); }
+void  operator delete(void *_ptr) noexcept                { std::free(_ptr); }
+void  operator delete[](void *_ptr) noexcept              { operator delete(_ptr); }
+void  operator delete(void *_ptr, std::size_t) noexcept   { operator delete(_ptr); }
+void  operator delete[](void *_ptr, std::size_t) noexcept { operator delete[](_ptr); }
+
+int main(int argc, char const *argv[])
+{
+    return TS::_Cycle_::ALL_TESTS();
+}
+
+namespace TS { namespace _Cycle_
+{
+/** ALLTESTS: ( OS::CPU cycle ) */
+BoolInt ALL_TESTS()
+{
+ /** ALLTESTS: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    BoolInt results_ = TEST_PASSED;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    if ( results_ += ZERO_ALLOCATIONS() ) return results_;
+    if ( results_ += ROUND_RESET() )      return results_;
+    if ( results_ += NEXT_PC() )          return results_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return results_;
+} /* ALL_TESTS() */
+
+namespace /* {anonymous} */
+{
+/** TEST: no heap allocations per cycle (after warm up) */
+BoolInt ZERO_ALLOCATIONS()
+{
+    int constexpr n_cycles       = 1000000,
+                  warm_up        = 1000,
+                  max_cycles     = 20000,
+                  max_processes  = 8,
+                  max_insts      = 12,
+                  min_seperation = 8;
+
+    Asm::ProgramVec programs;
+    if (!load_warriors(programs, {"paper.asm", "scissors.asm"}, max_insts))
+        return TEST_FAILED;
+
+    uint64_t seed = 0;
+    Memory    memory_(&programs, min_seperation, seed);
+    Scheduler sched_ (&programs, max_cycles, max_processes);
+    CPU       core_  (&memory_, &sched_);
+
+    for (int i = 0; i < warm_up; i++)
+    {
+        core_.run_fde_cycle();
+    }
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+        'paper.asm' vs 'scissors.asm', rounds of 20000 cycles
+        (the core is rebuilt between rounds, which is not counted)
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"run_fde_cycle()", "ZERO_ALLOCATIONS()", ""} ));
+    long E_, A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Heap Allocations Over 1M Cycles";
+
+    E_ = 0;
+
+    allocations       = 0;
+    track_allocations = true;
+    for (int i = 0; i < n_cycles; i++)
+    {
+        if (core_.run_fde_cycle().status >= Status::HAULTED)
+        {
+            // next round
+            track_allocations = false;
+            memory_ = Memory(&programs, min_seperation, ++seed);
+            sched_  = Scheduler(&programs, max_cycles, max_processes);
+            track_allocations = true;
+        }
+    }
+    track_allocations = false;
+
+    A_ = allocations;
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* ZERO_ALLOCATIONS() */
+
+/** TEST: reset core matches a new core, without allocating */
+BoolInt ROUND_RESET()
+{
+    int constexpr n_rounds       = 50,
+                  max_cycles     = 20000,
+                  max_processes  = 8,
+                  max_insts      = 12,
+                  min_seperation = 8;
+
+    Asm::ProgramVec programs;
+    if (!load_warriors(programs, {"paper.asm", "scissors.asm"}, max_insts))
+        return TEST_FAILED;
+
+    Memory    reset_mem   (&programs, min_seperation, 0);
+    Scheduler reset_sched (&programs, max_cycles, max_processes);
+    CPU       reset_cpu   (&reset_mem, &reset_sched);
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+        'paper.asm' vs 'scissors.asm', 50 rounds (seed = round)
+        [reset] Memory::reset(), Scheduler::reset() | identical rounds
+        [new]   Memory(), Scheduler()               |
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"run_fde_cycle()", "ROUND_RESET()", ""} ));
+    long E_, A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    long mismatches_ = 0,
+         reset_allocations = 0;
+    for (int round = 1; round <= n_rounds; round++)
+    {
+        // play the previous round to the end, dirtying the core and the queues
+        while (reset_cpu.run_fde_cycle().status < Status::HAULTED);
+
+        allocations       = 0;
+        track_allocations = true;
+        reset_mem.reset(&programs, min_seperation, round);
+        reset_sched.reset(&programs, max_cycles, max_processes);
+        track_allocations = false;
+        reset_allocations += allocations;
+
+        Memory    new_mem   (&programs, min_seperation, round);
+        Scheduler new_sched (&programs, max_cycles, max_processes);
+        CPU       new_cpu   (&new_mem, &new_sched);
+
+        mismatches_ += reset_sched.processes() != new_sched.processes()
+                    || reset_sched.programs()  != new_sched.programs();
+
+        // both cores play the round identically
+        Status status_ = Status::ACTIVE;
+        while (status_ < Status::HAULTED)
+        {
+            Report const reset_rpt = reset_cpu.run_fde_cycle(),
+                         new_rpt   = new_cpu.run_fde_cycle();
+            mismatches_ += reset_rpt.program != new_rpt.program
+                        || reset_rpt.status  != new_rpt.status
+                        || reset_rpt.next_pc != new_rpt.next_pc;
+            status_ = new_rpt.status;
+        }
+        for (int i = 0; i < new_mem.size(); i++)
+        {
+            mismatches_ += reset_mem.cell(i) != new_mem.cell(i);
+        }
+
+        // start the next round from a dirty core
+        reset_mem.reset(&programs, min_seperation, round);
+        reset_sched.reset(&programs, max_cycles, max_processes);
+    }
+
+ HDR_.info.test_desc = "Reset Rounds Match New Rounds";
+    E_ = 0;
+    A_ = mismatches_;
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Heap Allocations Per Reset";
+    E_ = 0;
+    A_ = reset_allocations;
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* ROUND_RESET() */
+
+/** TEST: the scheduler's next program counter is the next instruction executed */
+BoolInt NEXT_PC()
+{
+    int constexpr n_rounds       = 20,
+                  max_cycles     = 20000,
+                  max_processes  = 8,
+                  max_insts      = 12,
+                  min_seperation = 8;
+
+    Asm::ProgramVec programs;
+    if (!load_warriors(programs, {"paper.asm", "scissors.asm"}, max_insts))
+        return TEST_FAILED;
+
+    Memory    memory_(&programs, min_seperation, 0);
+    Scheduler sched_ (&programs, max_cycles, max_processes);
+    CPU       core_  (&memory_, &sched_);
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+        'paper.asm' vs 'scissors.asm', 20 rounds (seed = round)
+        [E] Scheduler::next_pc() before each cycle (peek, prefetched)
+        [A] address of the instruction executed by the cycle
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"prefetch_fetch()", "NEXT_PC()", ""} ));
+    long E_, A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    long mismatches_ = 0,
+         cycles_     = 0;
+    for (int round = 1; round <= n_rounds; round++)
+    {
+        memory_.reset(&programs, min_seperation, round);
+        sched_.reset(&programs, max_cycles, max_processes);
+
+        Status status_ = Status::ACTIVE;
+        while (status_ < Status::HAULTED)
+        {
+            int const next_pc_ = memory_.normalise(sched_.next_pc());
+            core_.prefetch_fetch();
+            core_.prefetch_decode();
+
+            Report const &rpt_ = core_.run_fde_cycle();
+            status_ = rpt_.status;
+            if (status_ < Status::HAULTED)
+            {
+                mismatches_ += rpt_.exe.address != next_pc_;
+                cycles_++;
+            }
+        }
+    }
+
+ HDR_.info.test_desc = "Mismatched Program Counters";
+    E_ = 0;
+    A_ = mismatches_;
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Cycles Checked";
+    E_ = 1;
+    A_ = cycles_ > 0;
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* NEXT_PC() */
+
+} /* ::{anonymous} */
+}}/* ::TS::_Cycle_ */
@@ -0,0 +1,212 @@
+#include "tester-evaluation.hpp"
+
+int main(int argc, char const *argv[])
+{
+    return TS::_Evaluation_::ALL_TESTS();
+}
+
+namespace TS { namespace _Evaluation_
+{
+/** ALLTESTS: ( Core::Evaluation ) */
+BoolInt ALL_TESTS()
+{
+ /** ALLTESTS: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    BoolInt results_ = TEST_PASSED;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    if ( results_ += OFFSETS() ) return results_;
+    if ( results_ += THREADS() ) return results_;
+    if ( results_ += SCORE() )   return results_;
+    if ( results_ += GAME() )    return results_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return results_;
+} /* ALL_TESTS() */
+
+namespace /* {anonymous} */
+{
+/** TEST: every legal offset of the second warrior is played, once */
+BoolInt OFFSETS()
+{
+    int constexpr core_size      = 1024,    // 'tester-game-small/core.ini'
+                  min_seperation = 8;
+
+    Evaluation evaluation_("rock.asm", "scissors.asm");
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+        'rock.asm' at 0 vs 'scissors.asm' at each offset
+        core of 1024, min separation of 8
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"run()", "OFFSETS()", ""} ));
+    long E_, A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Evaluation Completes";
+    E_ = (long) State::COMPLETE;
+    A_ = (long) run_in("tester-game-small", evaluation_);
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Offsets Played";
+    E_ = core_size - 2 * min_seperation + 1;
+    A_ = evaluation_.offsets();
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "First Offset";
+    E_ = min_seperation;
+    A_ = evaluation_.first_offset();
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Last Offset";
+    E_ = core_size - min_seperation;
+    A_ = evaluation_.last_offset();
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "One Round Per Offset";
+    E_ = evaluation_.offsets();
+    A_ = evaluation_.record().rounds();
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* OFFSETS() */
+
+/** TEST: winners are identical for any number of threads (and between runs) */
+BoolInt THREADS()
+{
+    Evaluation single_("rock.asm", "scissors.asm", 1),
+               pool_  ("rock.asm", "scissors.asm", 4);
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+        'rock.asm' at 0 vs 'scissors.asm' at each offset, core of 1024
+        [single]  1 thread              | identical winner
+        [pool]    4 threads, run twice  | at every offset
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"run()", "THREADS()", ""} ));
+    long E_, A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    if (run_in("tester-game-small", single_) != State::COMPLETE
+     || run_in("tester-game-small", pool_)   != State::COMPLETE)
+        return TEST_FAILED;
+
+ HDR_.info.test_desc = "1 vs 4 Threads";
+    E_ = 0;
+    A_ = single_.offsets() != pool_.offsets();
+    for (int offset = pool_.first_offset(); A_ == 0 && offset <= pool_.last_offset(); offset++)
+    {
+        A_ += single_.winner(offset) != pool_.winner(offset);
+    }
+    RUN_TEST(E_, A_, HDR_);
+
+    std::vector<Player> winners_;
+    for (int offset = pool_.first_offset(); offset <= pool_.last_offset(); offset++)
+    {
+        winners_.push_back(pool_.winner(offset));
+    }
+    if (run_in("tester-game-small", pool_) != State::COMPLETE)
+        return TEST_FAILED;
+
+ HDR_.info.test_desc = "Run Again";
+    E_ = 0;
+    A_ = (long) winners_.size() != pool_.offsets();
+    for (int offset = pool_.first_offset(); A_ == 0 && offset <= pool_.last_offset(); offset++)
+    {
+        A_ += winners_[offset - pool_.first_offset()] != pool_.winner(offset);
+    }
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* THREADS() */
+
+/** TEST: score of a known pair over every offset */
+BoolInt SCORE()
+{
+    Evaluation evaluation_("rock.asm", "scissors.asm");
+    if (run_in("tester-game", evaluation_) != State::COMPLETE)
+        return TEST_FAILED;
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+        'rock.asm' at 0 vs 'scissors.asm' at each offset, points of 'rock.asm'
+        (default 'core.ini': core of 8192, 20000 cycles, 8 processes)
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"record()", "SCORE()", ""} ));
+    long E_, A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Offsets Played";
+    E_ = 8192 - 2 * 8 + 1;
+    A_ = evaluation_.offsets();
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Rock vs Scissors";
+    E_ = 11461;
+    A_ = evaluation_.record().score();
+    RUN_TEST(E_, A_, HDR_);
+
+ HDR_.info.test_desc = "Record Matches The Winners";
+    Record record_;
+    for (int offset = evaluation_.first_offset(); offset <= evaluation_.last_offset(); offset++)
+    {
+        Player const winner_ = evaluation_.winner(offset);
+        if      (winner_ == Player::NONE) record_.ties++;
+        else if (winner_ == Player::P1)   record_.wins++;
+        else                              record_.losses++;
+    }
+    E_ = record_.score();
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* SCORE() */
+
+/** TEST: every offset has the winner of the same round played by a game */
+BoolInt GAME()
+{
+    Evaluation evaluation_("rock.asm", "scissors.asm");
+    if (run_in("tester-game-small", evaluation_) != State::COMPLETE)
+        return TEST_FAILED;
+
+    // the game loads its settings and warriors from the resource directory too
+    std::filesystem::path const cwd_ = std::filesystem::current_path();
+    std::filesystem::current_path("tester-game-small");
+    BattleTemplate const template_({"rock.asm", "scissors.asm"});
+    std::filesystem::current_path(cwd_);
+    if (!template_.loaded())
+        return TEST_FAILED;
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+        'rock.asm' at 0 vs 'scissors.asm' at each offset, core of 1024
+        [lanes]  Evaluation::run()           | identical winner
+        [game]   Game::play_placed_round()   | at every offset
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"run()", "GAME()", ""} ));
+    long E_, A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Lanes Match Game::play_placed_round()";
+    Game game_;
+    E_ = 0;
+    A_ = 0;
+    for (int offset = evaluation_.first_offset(); offset <= evaluation_.last_offset(); offset++)
+    {
+        if (game_.new_game(template_) != State::NEW_ROUND)
+            return TEST_FAILED;
+        A_ += evaluation_.winner(offset) != game_.play_placed_round({ 0, offset });
+    }
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+ HDR_.info.test_desc = "Placed Round After A Game ( Idiom Hits )";
+    Game played_,
+         fresh_;
+    played_.new_game(template_);
+    while (played_.state() != State::COMPLETE)
+    {
+        played_.run_round();
+    }
+    played_.play_placed_round({ 0, evaluation_.first_offset() });
+
+    fresh_.new_game(template_);
+    fresh_.play_placed_round({ 0, evaluation_.first_offset() });
+
+    // only the placed round is counted, not the rounds of the game before it
+    E_ = fresh_.idiom_hits(OS::Idiom::STONE);
+    A_ = played_.idiom_hits(OS::Idiom::STONE);
+    RUN_TEST(E_, A_, HDR_);
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* GAME() */
+
+} /* ::{anonymous} */
+}}/* ::TS::_Evaluation_ */
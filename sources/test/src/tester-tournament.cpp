@@ -0,0 +1,178 @@
+#include <filesystem>
+#include "tester-tournament.hpp"
+
+int main(int argc, char const *argv[])
+{
+    // games load 'core.ini' and 'warriors/' from the working directory
+    std::error_code err_;
+    std::filesystem::current_path("tester-game", err_);
+    if (err_)
+        return TS::TEST_FAILED;
+
+    return TS::_Tournament_::ALL_TESTS();
+}
+
+namespace TS { namespace _Tournament_
+{
+/** ALLTESTS: ( Core::Tournament ) */
+BoolInt ALL_TESTS()
+{
+ /** ALLTESTS: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    BoolInt results_ = TEST_PASSED;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    if ( results_ += THREADS() ) return results_;
+    if ( results_ += RECORDS() ) return results_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return results_;
+} /* ALL_TESTS() */
+
+namespace /* {anonymous} */
+{
+/** TEST: results are identical for any number of threads (and interleaved battles) */
+BoolInt THREADS()
+{
+    WarriorFiles const files_ = {"dat.asm", "imp.asm", "rock.asm"};
+    uint64_t constexpr seed   = 7;
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+        'dat.asm', 'imp.asm', 'rock.asm', seed 7, 3 rounds per battle
+        [single]  1 thread                  | identical matrix
+        [pool]    4 threads                 | + totals
+        [pool]    4 threads, 2 interleaved  |
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"run()", "THREADS()", ""} ));
+    long E_, A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    for (int melee : {2, 3})
+    {
+        Tournament single_     (files_, melee, 1, seed);
+        Tournament pool_       (files_, melee, 4, seed);
+        Tournament interleaved_(files_, melee, 4, seed, 2);
+
+     HDR_.info.test_desc = std::to_string(melee) + "-Way Battles Complete";
+        E_ = 0;
+        A_ = (single_.run()      != State::COMPLETE)
+           + (pool_.run()        != State::COMPLETE)
+           + (interleaved_.run() != State::COMPLETE);
+        RUN_TEST(E_, A_, HDR_);
+
+     HDR_.info.test_desc = std::to_string(melee) + "-Way Battles, 1 vs 4 Threads";
+        E_ = 0;
+        A_ = mismatched_records(single_, pool_);
+        RUN_TEST(E_, A_, HDR_);
+
+     HDR_.info.test_desc = std::to_string(melee) + "-Way Battles, 1 vs 4 Threads (Interleaved)";
+        E_ = 0;
+        A_ = mismatched_records(single_, interleaved_);
+        RUN_TEST(E_, A_, HDR_);
+    }
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* THREADS() */
+
+/** TEST: matrix and totals agree with each other, dead warriors never tie */
+BoolInt RECORDS()
+{
+    WarriorFiles const files_ = {"dat.asm", "imp.asm", "rock.asm"};
+    uint64_t constexpr seed   = 7;
+    int constexpr max_rounds  = 3,  // 'tester-game/core.ini'
+                  dat         = 0;  // dies on its first cycle, every round
+
+ /** ENVIROMENT: *//*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~/
+        'dat.asm', 'imp.asm', 'rock.asm', seed 7, 3 rounds per battle, 4 threads
+        [matrix]  wins of i vs j are the losses of j vs i, ties are even
+        [totals]  rounds of a warrior are its battles' rounds
+        [dat]     loses every round, a draw is only tied by the survivors
+ *//** SUITE: ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    Header HDR_ (suite_info( {"record_game()", "RECORDS()", ""} ));
+    long E_, A_;
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    for (int melee : {2, 3})
+    {
+        Tournament tournament_(files_, melee, 4, seed);
+        if (tournament_.run() != State::COMPLETE)
+            return TEST_FAILED;
+
+        int const warriors_ = tournament_.warriors();
+
+     HDR_.info.test_desc = std::to_string(melee) + "-Way Battles, Matrix Is Consistent";
+        E_ = 0;
+        A_ = 0;
+        for (int i = 0; i < warriors_; i++)
+        {
+            A_ += tournament_.record(i, i).rounds() != 0;
+            for (int j = 0; j < warriors_; j++)
+            {
+                Record const &ij_ = tournament_.record(i, j),
+                             &ji_ = tournament_.record(j, i);
+                A_ += ij_.wins != ji_.losses || ij_.ties != ji_.ties;
+            }
+        }
+        RUN_TEST(E_, A_, HDR_);
+
+     HDR_.info.test_desc = std::to_string(melee) + "-Way Battles, Rounds Per Warrior";
+        E_ = 0;
+        A_ = 0;
+        for (int i = 0; i < warriors_; i++)
+        {
+            int battles_ = 0;
+            for (int b = 0; b < tournament_.battles(); b++)
+            {
+                Battle const &battle_ = tournament_.battle(b);
+                battles_ += std::find(battle_.begin(), battle_.end(), i) != battle_.end();
+            }
+            A_ += tournament_.total(i).rounds() != battles_ * max_rounds;
+        }
+        RUN_TEST(E_, A_, HDR_);
+
+        // pairings: every round is one record of the matrix
+        if (melee == 2)
+        {
+         HDR_.info.test_desc = "2-Way Battles, Totals Are The Matrix's";
+            E_ = 0;
+            A_ = 0;
+            for (int i = 0; i < warriors_; i++)
+            {
+                Record sum_;
+                for (int j = 0; j < warriors_; j++)
+                {
+                    sum_ += tournament_.record(i, j);
+                }
+                Record const &total_ = tournament_.total(i);
+                A_ += sum_.wins != total_.wins || sum_.ties != total_.ties || sum_.losses != total_.losses;
+            }
+            RUN_TEST(E_, A_, HDR_);
+        }
+
+     HDR_.info.test_desc = std::to_string(melee) + "-Way Battles, Dead Warrior Loses Every Round";
+        E_ = tournament_.total(dat).rounds();
+        A_ = tournament_.total(dat).losses;
+        RUN_TEST(E_, A_, HDR_);
+
+     HDR_.info.test_desc = std::to_string(melee) + "-Way Battles, Dead Warrior Never Ties";
+        E_ = 0;
+        A_ = 0;
+        for (int j = 0; j < warriors_; j++)
+        {
+            A_ += tournament_.record(dat, j).ties;
+        }
+        RUN_TEST(E_, A_, HDR_);
+
+        // every round, the winner (or every survivor of a draw) beats the dead warrior
+     HDR_.info.test_desc = std::to_string(melee) + "-Way Battles, Dead Warrior Is Beaten";
+        HDR_.cmp_op = CMP_OP::LTEQ;
+        E_ = tournament_.total(dat).rounds();
+        A_ = 0;
+        for (int j = 0; j < warriors_; j++)
+        {
+            A_ += tournament_.record(j, dat).wins;
+        }
+        RUN_TEST(E_, A_, HDR_);
+        HDR_.cmp_op = CMP_OP::EQ;
+    }
+ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    return HDR_.result;
+} /* RECORDS() */
+
+} /* ::{anonymous} */
+}}/* ::TS::_Tournament_ */
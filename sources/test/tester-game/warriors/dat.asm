@@ -0,0 +1,4 @@
+;;; name:   Suicide (tester warrior)
+;;; syntax: <label> [opcode].<modifier> <admo>[A], <admo>[B]
+
+dat  #0,  #0  ;; the only process dies on its first cycle
@@ -0,0 +1,4 @@
+;;; name: Imp (Single Line Program example)
+;;; syntax: <label> [opcode].<modifier> <admo>[A], <admo>[B]
+
+mov 0, 1  ;; move instruction one space ahead, which is executed on the next turn